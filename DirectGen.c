@@ -0,0 +1,419 @@
+/*
+ * DirectGen - generator of the direct-coded LR parser
+ *
+ *   cc -O2 -o directgen DirectGen.c Scanner.c -lpthread
+ *   directgen [MiniC.gr [DirectParser.c]]
+ *
+ * reads the grammar MiniC.gr and the parsing table MiniC.tbl and writes
+ * directParser(), an LR parser with the table compiled into code:
+ *     state_N:  a switch on the lookahead token. a shift pushes the
+ *               next state and jumps to it, a reduction jumps to its
+ *               rule. the error lookaheads go to error, the default of
+ *               the switch is the error or the most frequent reduction,
+ *               whichever saves more cases. like parser(), an error is
+ *               found in the same state as with the dense table.
+ *     reduce_R: the tree building of buildTree() specialized for rule
+ *               R: terminals without a value are skipped and the
+ *               brothers are linked in straight line code.
+ *     goto_L:   a switch on the uncovered state that pushes the goto
+ *               state of nonterminal L and jumps to it.
+ * a shift or a goto that is followed by a chain of unit reductions
+ * without a node(primary_exp -> '%ident', postfix_exp -> primary_exp,
+ * ...) switches on the lookahead and pushes the state where the chain
+ * ends, so the reduce_R blocks of those rules are only reached after an
+ * error recovery.
+ * the generator includes Parser.c, so it works from the same table,
+ * ruleName[] and unit chains as parser() and the trees built by the two
+ * parsers are identical, for a source with errors too. the grammar gives
+ * the rules and tells terminals from nonterminals; it is checked against
+ * the table.
+ */
+#include "Parser.c"
+
+#define MAX_RHS 8           // longest right hand side
+#define NAME_LENGTH 32
+
+typedef struct {
+    char lhs[NAME_LENGTH];
+    int length;
+    char rhs[MAX_RHS][NAME_LENGTH];
+    int terminal[MAX_RHS];
+    char node[NAME_LENGTH];     // node name of the grammar, "" if none
+} Rule;
+
+Rule rules[NO_RULES + 1];
+char symbolName[NO_SYMBOLS + 1][NAME_LENGTH];
+int firstNonterminal;
+
+FILE *grammar, *out;
+int line = 1;
+
+void genError(char *message, char *text)
+{
+    printf("directgen: %s %s(line %d)\n", message, text, line);
+    exit(1);
+}
+
+// next word of the grammar: a quoted terminal, a name, "->", "=>" or ";".
+// returns 0 at the end of the file.
+int nextWord(char *word)
+{
+    int ch, n = 0;
+
+    do {
+        ch = getc(grammar);
+        if (ch == '\n') line++;
+    } while (ch != EOF && isspace(ch));
+    if (ch == EOF) return 0;
+
+    if (ch == '\'') {
+        word[n++] = ch;
+        while ((ch = getc(grammar)) != EOF && ch != '\'' && n < NAME_LENGTH - 2)
+            word[n++] = ch;
+        word[n++] = '\'';
+    }
+    else if (ch == ';') word[n++] = ch;
+    else if (ch == '-' || ch == '=') {
+        word[n++] = ch;
+        word[n++] = getc(grammar);
+    }
+    else {
+        while (ch != EOF && !isspace(ch) && ch != ';' && ch != '-' && n < NAME_LENGTH - 1) {
+            word[n++] = ch;
+            ch = getc(grammar);
+        }
+        ungetc(ch, grammar);
+    }
+    word[n] = '\0';
+    return 1;
+}
+
+// the SYNTAX part: [lhs] -> symbol ... [=> NODE] ;
+void readGrammar(char *fileName)
+{
+    char word[NAME_LENGTH], lhs[NAME_LENGTH];
+    Rule *r;
+    int n = 0;
+
+    if ((grammar = fopen(fileName, "r")) == NULL) genError("cannot open", fileName);
+    while (nextWord(word) && strcmp(word, "SYNTAX"));
+    nextWord(word);     // start symbol
+
+    lhs[0] = '\0';
+    while (nextWord(word)) {
+        if (strcmp(word, "->")) {
+            strcpy(lhs, word);
+            nextWord(word);
+        }
+        if (strcmp(word, "->") || !lhs[0]) genError("rule expected at", word);
+        if (++n > NO_RULES) genError("more rules than in the table at", word);
+        r = &rules[n];
+        strcpy(r->lhs, lhs);
+        while (nextWord(word) && strcmp(word, ";")) {
+            if (!strcmp(word, "=>")) {
+                nextWord(r->node);
+                continue;
+            }
+            if (r->length == MAX_RHS) genError("right hand side too long at", word);
+            strcpy(r->rhs[r->length], word);
+            r->terminal[r->length++] = word[0] == '\'';
+        }
+    }
+    fclose(grammar);
+    if (n != NO_RULES) genError("fewer rules than in the table at", "end");
+}
+
+// token number of a quoted terminal of the grammar
+int tokenNumber(char *word)
+{
+    char name[NAME_LENGTH];
+    int i;
+
+    if (!strcmp(word, "'%ident'")) return tident;
+    if (!strcmp(word, "'%number'")) return tnumber;
+    strcpy(name, word + 1);
+    name[strlen(name) - 1] = '\0';
+    for (i = 0; i < firstNonterminal; i++)
+        if (!strcmp(tokenName[i], name)) return i;
+    genError("unknown terminal", word);
+    return -1;
+}
+
+// the grammar and the table must describe the same rules
+void checkGrammar()
+{
+    int i, j;
+
+    firstNonterminal = NO_SYMBOLS + 1;
+    for (i = 1; i <= NO_RULES; i++)
+        if (leftSymbol[i] < firstNonterminal) firstNonterminal = leftSymbol[i];
+    for (i = 0; i < firstNonterminal; i++)
+        sprintf(symbolName[i], "'%s'", tokenName[i]);
+
+    for (i = 1; i <= NO_RULES; i++) {
+        line = i;
+        if (rules[i].length != rightLength[i])
+            genError("length differs from the table in rule", rules[i].lhs);
+        // ruleName[] 0 is no node, which makes ACTUAL_PARAM(0) one too
+        if (ruleName[i] ? !rules[i].node[0]
+                : rules[i].node[0] && strcmp(rules[i].node, nodeName[0]))
+            genError("node differs from ruleName[] in rule", rules[i].lhs);
+        if (!symbolName[leftSymbol[i]][0])
+            strcpy(symbolName[leftSymbol[i]], rules[i].lhs);
+        else if (strcmp(symbolName[leftSymbol[i]], rules[i].lhs))
+            genError("left hand side differs from the table in rule", rules[i].lhs);
+        for (j = 0; j < rules[i].length; j++)
+            if (rules[i].terminal[j]) tokenNumber(rules[i].rhs[j]);
+    }
+}
+
+void printRule(int r)
+{
+    int i;
+
+    fprintf(out, "%s ->", rules[r].lhs);
+    for (i = 0; i < rules[r].length; i++) fprintf(out, " %s", rules[r].rhs[i]);
+    if (ruleName[r]) fprintf(out, " => %s", nodeName[ruleName[r]]);
+}
+
+// pushes state q entered from state p on symbol and jumps to it. if a
+// chain of unit reductions follows, the state where it ends for the
+// lookahead is pushed instead(see unitChain in Parser.c).
+void genPush(int p, int symbol, int q, char *value, char *tail, char *indent)
+{
+    int end[NO_SYMBOLS + 1], done[NO_SYMBOLS + 1], defaultEnd, row, t, i;
+
+    if (!(row = chainRow[p][symbol])) {
+        fprintf(out, "%sPUSH(%d, %d, %s, %s);\n", indent, q, symbol, value, tail);
+        fprintf(out, "%sgoto state_%d;\n", indent, q);
+        return;
+    }
+    for (t = 0; t < noTerminals; t++) {
+        end[t] = unitChain[row * noTerminals + t];
+        done[t] = 0;
+    }
+    defaultEnd = mostFrequent(end, noTerminals, 1);
+    fprintf(out, "%sswitch (token.number) {\n", indent);
+    for (t = 0; t < noTerminals; t++) {
+        if (end[t] == defaultEnd || done[t]) continue;
+        for (i = t; i < noTerminals; i++)
+            if (end[i] == end[t]) {
+                fprintf(out, "%scase %d:     /* %s */\n", indent, i, symbolName[i]);
+                done[i] = 1;
+            }
+        fprintf(out, "%s    PUSH(%d, %d, %s, %s);\n", indent, end[t], accessSymbol[end[t]], value, tail);
+        fprintf(out, "%s    goto state_%d;\n", indent, end[t]);
+    }
+    fprintf(out, "%sdefault:\n", indent);
+    fprintf(out, "%s    PUSH(%d, %d, %s, %s);\n", indent, defaultEnd, accessSymbol[defaultEnd], value, tail);
+    fprintf(out, "%s    goto state_%d;\n", indent, defaultEnd);
+    fprintf(out, "%s}\n", indent);
+}
+
+// the default of the switch is the most frequent reduction when it has
+// more lookaheads than the error, whose lookaheads are then listed
+void genState(int state)
+{
+    int symbol, entry, defaultRule, done[NO_SYMBOLS + 1];
+    int i, noErrors, noDefaults;
+
+    fprintf(out, "state_%d:\n", state);
+    fprintf(out, "    switch (token.number) {\n");
+    defaultRule = mostFrequent(parsingTable[state], firstNonterminal, -1);
+    for (noErrors = noDefaults = symbol = 0; symbol < firstNonterminal; symbol++) {
+        if (!parsingTable[state][symbol]) noErrors++;
+        else if (parsingTable[state][symbol] == defaultRule) noDefaults++;
+    }
+    if (noErrors >= noDefaults) defaultRule = 0;
+    for (symbol = 0; symbol < firstNonterminal; symbol++) done[symbol] = 0;
+    if (defaultRule && noErrors) {
+        for (symbol = 0; symbol < firstNonterminal; symbol++)
+            if (!parsingTable[state][symbol])
+                fprintf(out, "    case %d:     /* %s */\n", symbol, symbolName[symbol]);
+        fprintf(out, "        goto error;\n");
+    }
+    for (symbol = 0; symbol < firstNonterminal; symbol++) {
+        entry = parsingTable[state][symbol];
+        if (!entry || entry == defaultRule || done[symbol]) continue;
+        if (entry > 0) {                    // shift
+            fprintf(out, "    case %d:     /* %s */\n", symbol, symbolName[symbol]);
+            if (symbol == tident || symbol == tnumber) {
+                fprintf(out, "        value = buildNode(token);\n");
+                fprintf(out, "        token = c->nextToken();\n");
+                genPush(state, symbol, entry, "value", "value", "        ");
+            }
+            else {
+                fprintf(out, "        token = c->nextToken();\n");
+                genPush(state, symbol, entry, "0", "0", "        ");
+            }
+            continue;
+        }
+        for (i = symbol; i < firstNonterminal; i++)
+            if (parsingTable[state][i] == entry) {
+                fprintf(out, "    case %d:     /* %s */\n", i, symbolName[i]);
+                done[i] = 1;
+            }
+        if (entry == -GOAL_RULE) fprintf(out, "        goto accept;\n");
+        else fprintf(out, "        goto reduce_%d;\n", -entry);
+    }
+    if (defaultRule == -GOAL_RULE) fprintf(out, "    default:\n        goto accept;\n");
+    else if (defaultRule) fprintf(out, "    default:\n        goto reduce_%d;\n", -defaultRule);
+    else fprintf(out, "    default:\n        goto error;\n");
+    fprintf(out, "    }\n\n");
+}
+
+// the brothers of a right hand side are linked as in buildTree(). known
+// is 0 while nothing can have been linked, 1 when first may be set and
+// 2 when it is.
+void genReduce(int r)
+{
+    int i, k, known = 0;
+    char v[32], t[32];
+
+    fprintf(out, "reduce_%d:       /* ", r);
+    printRule(r);
+    fprintf(out, " */\n");
+    k = rules[r].length;
+    for (i = 0; i < k; i++) {
+        if (rules[r].terminal[i] && strcmp(rules[r].rhs[i], "'%ident'")
+                && strcmp(rules[r].rhs[i], "'%number'"))
+            continue;                       // has no node
+        if (k - 1 - i) {
+            sprintf(v, "valueStack[sp - %d]", k - 1 - i);
+            sprintf(t, "tailStack[sp - %d]", k - 1 - i);
+        }
+        else {
+            strcpy(v, "valueStack[sp]");
+            strcpy(t, "tailStack[sp]");
+        }
+        if (rules[r].terminal[i]) {         // always a node
+            if (known == 0) fprintf(out, "    first = %s;\n", v);
+            else if (known == 1)
+                fprintf(out, "    if (last) NODE(last).brother = %s;\n"
+                        "    else first = %s;\n", v, v);
+            else fprintf(out, "    NODE(last).brother = %s;\n", v);
+            fprintf(out, "    last = %s;\n", t);
+            known = 2;
+        }
+        else if (known == 0) {
+            fprintf(out, "    first = %s;\n    last = %s;\n", v, t);
+            known = 1;
+        }
+        else {
+            fprintf(out, "    if ((value = %s)) {\n", v);
+            if (known == 1)
+                fprintf(out, "        if (last) NODE(last).brother = value;\n"
+                        "        else first = value;\n");
+            else fprintf(out, "        NODE(last).brother = value;\n");
+            fprintf(out, "        last = %s;\n    }\n", t);
+        }
+    }
+    if (known == 0) fprintf(out, "    first = last = 0;\n");
+
+    if (ruleName[r]) {
+        fprintf(out, "    value = tail = newNode();\n");
+        fprintf(out, "    NODE(value).number = %s;\n", nodeName[ruleName[r]]);
+        fprintf(out, "    NODE(value).noderep = nonterm;\n");
+        fprintf(out, "    NODE(value).value = 0;\n");
+        fprintf(out, "    NODE(value).son = first;\n");
+        fprintf(out, "    NODE(value).brother = 0;\n");
+    }
+    else fprintf(out, "    value = first;\n    tail = last;\n");
+    if (k) fprintf(out, "    sp -= %d;\n", k);
+    fprintf(out, "    goto goto_%d;\n\n", leftSymbol[r]);
+}
+
+void genGoto(int lhs)
+{
+    int row[NO_STATES], state, defaultState;
+
+    for (state = 0; state < NO_STATES; state++) row[state] = parsingTable[state][lhs];
+    defaultState = mostFrequent(row, NO_STATES, 1);
+    fprintf(out, "goto_%d:         /* %s */\n", lhs, symbolName[lhs]);
+    fprintf(out, "    switch (stateStack[sp]) {\n");
+    for (state = 0; state < NO_STATES; state++) {
+        if (row[state] <= 0 || (row[state] == defaultState && !chainRow[state][lhs])) continue;
+        fprintf(out, "    case %d:\n", state);
+        genPush(state, lhs, row[state], "value", "tail", "        ");
+    }
+    fprintf(out, "    default:\n");
+    fprintf(out, "        PUSH(%d, %d, value, tail);\n", defaultState, lhs);
+    fprintf(out, "        goto state_%d;\n", defaultState);
+    fprintf(out, "    }\n\n");
+}
+
+void genParser()
+{
+    int state, r, lhs, used[NO_SYMBOLS + 1];
+
+    fprintf(out, "/* DirectParser.c - generated by DirectGen from MiniC.gr and MiniC.tbl, do not edit */\n");
+    fprintf(out, "#include \"Parser.h\"\n\n");
+    fprintf(out, "#define NODE(n) (c->nodes[n])\n");
+    fprintf(out, "#define PUSH(state, symbol, value, tail) do { \\\n");
+    fprintf(out, "    if (++sp >= c->stackSize) { \\\n");
+    fprintf(out, "        growStacks(); \\\n");
+    fprintf(out, "        stateStack = c->stateStack; symbolStack = c->symbolStack; \\\n");
+    fprintf(out, "        valueStack = c->valueStack; tailStack = c->tailStack; \\\n");
+    fprintf(out, "    } \\\n");
+    fprintf(out, "    stateStack[sp] = (state); symbolStack[sp] = (symbol); \\\n");
+    fprintf(out, "    valueStack[sp] = (value); tailStack[sp] = (tail); \\\n");
+    fprintf(out, "} while (0)\n\n");
+
+    fprintf(out, "int directParser()\n{\n");
+    fprintf(out, "    Compilation *c = cc;\n");
+    fprintf(out, "    struct tokenType token;\n");
+    fprintf(out, "    int *stateStack, *symbolStack, *valueStack, *tailStack;\n");
+    fprintf(out, "    int sp, value, tail, first, last;\n\n");
+    fprintf(out, "    if (!c->stackSize) growStacks();\n");
+    fprintf(out, "    stateStack = c->stateStack; symbolStack = c->symbolStack;\n");
+    fprintf(out, "    valueStack = c->valueStack; tailStack = c->tailStack;\n");
+    fprintf(out, "    sp = 0; stateStack[sp] = 0; // initial state\n");
+    fprintf(out, "    symbolStack[sp] = 0;\n");
+    fprintf(out, "    token = c->nextToken();\n");
+    fprintf(out, "    goto state_0;\n\n");
+
+    for (state = 0; state < NO_STATES; state++) genState(state);
+
+    for (lhs = 0; lhs <= NO_SYMBOLS; lhs++) used[lhs] = 0;
+    for (r = 1; r <= NO_RULES; r++) {
+        genReduce(r);
+        used[leftSymbol[r]] = 1;
+    }
+    for (lhs = firstNonterminal; lhs <= NO_SYMBOLS; lhs++)
+        if (used[lhs]) genGoto(lhs);
+
+    fprintf(out, "accept:\n");
+    fprintf(out, "    c->sp = sp;\n");
+    fprintf(out, "    return valueStack[sp - 1];\n\n");
+
+    fprintf(out, "error:\n");
+    fprintf(out, "    c->sp = sp;\n");
+    fprintf(out, "    c->errcnt++;\n");
+    fprintf(out, "    if (quietErrors) return 0;\n");
+    fprintf(out, "    printf(\" === error in source ===\\n\");\n");
+    fprintf(out, "    printf(\"Current Token : \");\n");
+    fprintf(out, "    printToken(token);\n");
+    fprintf(out, "    dumpStack();\n");
+    fprintf(out, "    if (!errorRecovery()) return 0;\n");
+    fprintf(out, "    sp = c->sp;\n");
+    fprintf(out, "    token = c->nextToken();\n");
+    fprintf(out, "    switch (stateStack[sp]) {\n");
+    for (state = 0; state < NO_STATES; state++)
+        fprintf(out, "    case %d: goto state_%d;\n", state, state);
+    fprintf(out, "    }\n");
+    fprintf(out, "    goto error;\n");
+    fprintf(out, "} // directParser\n");
+}
+
+int main(int argc, char *argv[])
+{
+    char *outName = argc > 2 ? argv[2] : "DirectParser.c";
+
+    readGrammar(argc > 1 ? argv[1] : "MiniC.gr");
+    checkGrammar();
+    initParsingTable();
+    if ((out = fopen(outName, "w")) == NULL) genError("cannot open", outName);
+    genParser();
+    fclose(out);
+    return 0;
+}
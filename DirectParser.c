@@ -0,0 +1,15957 @@
+/* DirectParser.c - generated by DirectGen from MiniC.gr and MiniC.tbl, do not edit */
+#include "Parser.h"
+
+#define NODE(n) (c->nodes[n])
+#define PUSH(state, symbol, value, tail) do { \
+    if (++sp >= c->stackSize) { \
+        growStacks(); \
+        stateStack = c->stateStack; symbolStack = c->symbolStack; \
+        valueStack = c->valueStack; tailStack = c->tailStack; \
+    } \
+    stateStack[sp] = (state); symbolStack[sp] = (symbol); \
+    valueStack[sp] = (value); tailStack[sp] = (tail); \
+} while (0)
+
+int directParser()
+{
+    Compilation *c = cc;
+    struct tokenType token;
+    int *stateStack, *symbolStack, *valueStack, *tailStack;
+    int sp, value, tail, first, last;
+
+    if (!c->stackSize) growStacks();
+    stateStack = c->stateStack; symbolStack = c->symbolStack;
+    valueStack = c->valueStack; tailStack = c->tailStack;
+    sp = 0; stateStack[sp] = 0; // initial state
+    symbolStack[sp] = 0;
+    token = c->nextToken();
+    goto state_0;
+
+state_0:
+    switch (token.number) {
+    case 30:     /* 'const' */
+        token = c->nextToken();
+        PUSH(14, 30, 0, 0);
+        goto state_14;
+    case 33:     /* 'int' */
+        token = c->nextToken();
+        PUSH(13, 33, 0, 0);
+        goto state_13;
+    case 35:     /* 'void' */
+        token = c->nextToken();
+        PUSH(12, 35, 0, 0);
+        goto state_12;
+    default:
+        goto error;
+    }
+
+state_1:
+    switch (token.number) {
+    case 4:     /* 'ident' */
+    case 30:     /* 'const' */
+    case 33:     /* 'int' */
+    case 35:     /* 'void' */
+        goto reduce_12;
+    default:
+        goto error;
+    }
+
+state_2:
+    switch (token.number) {
+    case 4:     /* 'ident' */
+    case 30:     /* 'const' */
+    case 33:     /* 'int' */
+    case 35:     /* 'void' */
+        goto reduce_11;
+    default:
+        goto error;
+    }
+
+state_3:
+    switch (token.number) {
+    case 29:     /* 'eof' */
+        goto reduce_1;
+    case 30:     /* 'const' */
+        token = c->nextToken();
+        PUSH(14, 30, 0, 0);
+        goto state_14;
+    case 33:     /* 'int' */
+        token = c->nextToken();
+        PUSH(13, 33, 0, 0);
+        goto state_13;
+    case 35:     /* 'void' */
+        token = c->nextToken();
+        PUSH(12, 35, 0, 0);
+        goto state_12;
+    default:
+        goto error;
+    }
+
+state_4:
+    switch (token.number) {
+    case 29:     /* 'eof' */
+        token = c->nextToken();
+        PUSH(16, 29, 0, 0);
+        goto state_16;
+    default:
+        goto error;
+    }
+
+state_5:
+    switch (token.number) {
+    case 37:     /* '{' */
+        token = c->nextToken();
+        PUSH(18, 37, 0, 0);
+        goto state_18;
+    default:
+        goto error;
+    }
+
+state_6:
+    switch (token.number) {
+    case 29:     /* 'eof' */
+    case 30:     /* 'const' */
+    case 33:     /* 'int' */
+    case 35:     /* 'void' */
+        goto reduce_4;
+    default:
+        goto error;
+    }
+
+state_7:
+    switch (token.number) {
+    case 29:     /* 'eof' */
+    case 30:     /* 'const' */
+    case 33:     /* 'int' */
+    case 35:     /* 'void' */
+        goto reduce_2;
+    default:
+        goto error;
+    }
+
+state_8:
+    switch (token.number) {
+    case 29:     /* 'eof' */
+    case 30:     /* 'const' */
+    case 33:     /* 'int' */
+    case 35:     /* 'void' */
+        goto reduce_5;
+    default:
+        goto error;
+    }
+
+state_9:
+    switch (token.number) {
+    case 4:     /* 'ident' */
+        goto reduce_8;
+    case 30:     /* 'const' */
+        token = c->nextToken();
+        PUSH(14, 30, 0, 0);
+        goto state_14;
+    case 33:     /* 'int' */
+        token = c->nextToken();
+        PUSH(13, 33, 0, 0);
+        goto state_13;
+    case 35:     /* 'void' */
+        token = c->nextToken();
+        PUSH(12, 35, 0, 0);
+        goto state_12;
+    default:
+        goto error;
+    }
+
+state_10:
+    switch (token.number) {
+    case 4:     /* 'ident' */
+    case 30:     /* 'const' */
+    case 33:     /* 'int' */
+    case 35:     /* 'void' */
+        goto reduce_9;
+    default:
+        goto error;
+    }
+
+state_11:
+    switch (token.number) {
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 7:     /* '(' */
+            PUSH(22, 59, value, value);
+            goto state_22;
+        default:
+            PUSH(24, 4, value, value);
+            goto state_24;
+        }
+    default:
+        goto error;
+    }
+
+state_12:
+    switch (token.number) {
+    case 4:     /* 'ident' */
+    case 30:     /* 'const' */
+    case 33:     /* 'int' */
+    case 35:     /* 'void' */
+        goto reduce_15;
+    default:
+        goto error;
+    }
+
+state_13:
+    switch (token.number) {
+    case 4:     /* 'ident' */
+    case 30:     /* 'const' */
+    case 33:     /* 'int' */
+    case 35:     /* 'void' */
+        goto reduce_14;
+    default:
+        goto error;
+    }
+
+state_14:
+    switch (token.number) {
+    case 4:     /* 'ident' */
+    case 30:     /* 'const' */
+    case 33:     /* 'int' */
+    case 35:     /* 'void' */
+        goto reduce_13;
+    default:
+        goto error;
+    }
+
+state_15:
+    switch (token.number) {
+    case 29:     /* 'eof' */
+    case 30:     /* 'const' */
+    case 33:     /* 'int' */
+    case 35:     /* 'void' */
+        goto reduce_3;
+    default:
+        goto error;
+    }
+
+state_16:
+    switch (token.number) {
+    default:
+        goto accept;
+    }
+
+state_17:
+    switch (token.number) {
+    case 29:     /* 'eof' */
+    case 30:     /* 'const' */
+    case 33:     /* 'int' */
+    case 35:     /* 'void' */
+        goto reduce_6;
+    default:
+        goto error;
+    }
+
+state_18:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 7:     /* '(' */
+    case 12:     /* '++' */
+    case 15:     /* '-' */
+    case 16:     /* '--' */
+    case 20:     /* ';' */
+    case 32:     /* 'if' */
+    case 34:     /* 'return' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto reduce_25;
+    case 30:     /* 'const' */
+        token = c->nextToken();
+        PUSH(14, 30, 0, 0);
+        goto state_14;
+    case 33:     /* 'int' */
+        token = c->nextToken();
+        PUSH(13, 33, 0, 0);
+        goto state_13;
+    case 35:     /* 'void' */
+        token = c->nextToken();
+        PUSH(12, 35, 0, 0);
+        goto state_12;
+    default:
+        goto error;
+    }
+
+state_19:
+    switch (token.number) {
+    case 4:     /* 'ident' */
+    case 30:     /* 'const' */
+    case 33:     /* 'int' */
+    case 35:     /* 'void' */
+        goto reduce_10;
+    default:
+        goto error;
+    }
+
+state_20:
+    switch (token.number) {
+    case 14:     /* ',' */
+    case 20:     /* ';' */
+        goto reduce_29;
+    default:
+        goto error;
+    }
+
+state_21:
+    switch (token.number) {
+    case 14:     /* ',' */
+        token = c->nextToken();
+        PUSH(30, 14, 0, 0);
+        goto state_30;
+    case 20:     /* ';' */
+        token = c->nextToken();
+        PUSH(29, 20, 0, 0);
+        goto state_29;
+    default:
+        goto error;
+    }
+
+state_22:
+    switch (token.number) {
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(32, 7, 0, 0);
+        goto state_32;
+    default:
+        goto error;
+    }
+
+state_23:
+    switch (token.number) {
+    case 14:     /* ',' */
+    case 20:     /* ';' */
+        goto reduce_31;
+    case 23:     /* '=' */
+        token = c->nextToken();
+        PUSH(33, 23, 0, 0);
+        goto state_33;
+    default:
+        goto error;
+    }
+
+state_24:
+    switch (token.number) {
+    case 7:     /* '(' */
+        goto reduce_16;
+    case 14:     /* ',' */
+    case 20:     /* ';' */
+    case 23:     /* '=' */
+        goto reduce_33;
+    case 27:     /* '[' */
+        token = c->nextToken();
+        PUSH(34, 27, 0, 0);
+        goto state_34;
+    default:
+        goto error;
+    }
+
+state_25:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, value);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, value);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, value);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(63, 4, value, value);
+            goto state_63;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, value);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, value);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, value);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(62, 5, value, value);
+            goto state_62;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    case 20:     /* ';' */
+        goto reduce_48;
+    case 32:     /* 'if' */
+        token = c->nextToken();
+        PUSH(57, 32, 0, 0);
+        goto state_57;
+    case 34:     /* 'return' */
+        token = c->nextToken();
+        PUSH(56, 34, 0, 0);
+        goto state_56;
+    case 36:     /* 'while' */
+        token = c->nextToken();
+        PUSH(55, 36, 0, 0);
+        goto state_55;
+    case 37:     /* '{' */
+        token = c->nextToken();
+        PUSH(18, 37, 0, 0);
+        goto state_18;
+    case 39:     /* '}' */
+        goto reduce_38;
+    default:
+        goto error;
+    }
+
+state_26:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 7:     /* '(' */
+    case 12:     /* '++' */
+    case 15:     /* '-' */
+    case 16:     /* '--' */
+    case 20:     /* ';' */
+    case 32:     /* 'if' */
+    case 34:     /* 'return' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto reduce_24;
+    case 30:     /* 'const' */
+        token = c->nextToken();
+        PUSH(14, 30, 0, 0);
+        goto state_14;
+    case 33:     /* 'int' */
+        token = c->nextToken();
+        PUSH(13, 33, 0, 0);
+        goto state_13;
+    case 35:     /* 'void' */
+        token = c->nextToken();
+        PUSH(12, 35, 0, 0);
+        goto state_12;
+    default:
+        goto error;
+    }
+
+state_27:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 7:     /* '(' */
+    case 12:     /* '++' */
+    case 15:     /* '-' */
+    case 16:     /* '--' */
+    case 20:     /* ';' */
+    case 30:     /* 'const' */
+    case 32:     /* 'if' */
+    case 33:     /* 'int' */
+    case 34:     /* 'return' */
+    case 35:     /* 'void' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto reduce_26;
+    default:
+        goto error;
+    }
+
+state_28:
+    switch (token.number) {
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        PUSH(66, 4, value, value);
+        goto state_66;
+    default:
+        goto error;
+    }
+
+state_29:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 7:     /* '(' */
+    case 12:     /* '++' */
+    case 15:     /* '-' */
+    case 16:     /* '--' */
+    case 20:     /* ';' */
+    case 29:     /* 'eof' */
+    case 30:     /* 'const' */
+    case 32:     /* 'if' */
+    case 33:     /* 'int' */
+    case 34:     /* 'return' */
+    case 35:     /* 'void' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto reduce_28;
+    default:
+        goto error;
+    }
+
+state_30:
+    switch (token.number) {
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        PUSH(66, 4, value, value);
+        goto state_66;
+    default:
+        goto error;
+    }
+
+state_31:
+    switch (token.number) {
+    case 37:     /* '{' */
+        goto reduce_7;
+    default:
+        goto error;
+    }
+
+state_32:
+    switch (token.number) {
+    case 8:     /* ')' */
+        goto reduce_19;
+    case 30:     /* 'const' */
+        token = c->nextToken();
+        PUSH(14, 30, 0, 0);
+        goto state_14;
+    case 33:     /* 'int' */
+        token = c->nextToken();
+        PUSH(13, 33, 0, 0);
+        goto state_13;
+    case 35:     /* 'void' */
+        token = c->nextToken();
+        PUSH(12, 35, 0, 0);
+        goto state_12;
+    default:
+        goto error;
+    }
+
+state_33:
+    switch (token.number) {
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        PUSH(72, 5, value, value);
+        goto state_72;
+    default:
+        goto error;
+    }
+
+state_34:
+    switch (token.number) {
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 28:     /* ']' */
+            PUSH(73, 72, value, value);
+            goto state_73;
+        default:
+            PUSH(74, 5, value, value);
+            goto state_74;
+        }
+    case 28:     /* ']' */
+        goto reduce_36;
+    default:
+        goto error;
+    }
+
+state_35:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 7:     /* '(' */
+    case 12:     /* '++' */
+    case 15:     /* '-' */
+    case 16:     /* '--' */
+    case 20:     /* ';' */
+    case 31:     /* 'else' */
+    case 32:     /* 'if' */
+    case 34:     /* 'return' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto reduce_44;
+    default:
+        goto error;
+    }
+
+state_36:
+    switch (token.number) {
+    case 1:     /* '!=' */
+    case 2:     /* '%' */
+    case 6:     /* '&&' */
+    case 8:     /* ')' */
+    case 9:     /* '*' */
+    case 11:     /* '+' */
+    case 14:     /* ',' */
+    case 15:     /* '-' */
+    case 18:     /* '/' */
+    case 20:     /* ';' */
+    case 21:     /* '<' */
+    case 22:     /* '<=' */
+    case 24:     /* '==' */
+    case 25:     /* '>' */
+    case 26:     /* '>=' */
+    case 28:     /* ']' */
+    case 38:     /* '||' */
+        goto reduce_76;
+    case 3:     /* '%=' */
+        token = c->nextToken();
+        PUSH(80, 3, 0, 0);
+        goto state_80;
+    case 10:     /* '*=' */
+        token = c->nextToken();
+        PUSH(79, 10, 0, 0);
+        goto state_79;
+    case 13:     /* '+=' */
+        token = c->nextToken();
+        PUSH(78, 13, 0, 0);
+        goto state_78;
+    case 17:     /* '-=' */
+        token = c->nextToken();
+        PUSH(77, 17, 0, 0);
+        goto state_77;
+    case 19:     /* '/=' */
+        token = c->nextToken();
+        PUSH(76, 19, 0, 0);
+        goto state_76;
+    case 23:     /* '=' */
+        token = c->nextToken();
+        PUSH(75, 23, 0, 0);
+        goto state_75;
+    default:
+        goto error;
+    }
+
+state_37:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, value);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, value);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, value);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(63, 4, value, value);
+            goto state_63;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, value);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, value);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, value);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(62, 5, value, value);
+            goto state_62;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    case 20:     /* ';' */
+        goto reduce_48;
+    case 32:     /* 'if' */
+        token = c->nextToken();
+        PUSH(57, 32, 0, 0);
+        goto state_57;
+    case 34:     /* 'return' */
+        token = c->nextToken();
+        PUSH(56, 34, 0, 0);
+        goto state_56;
+    case 36:     /* 'while' */
+        token = c->nextToken();
+        PUSH(55, 36, 0, 0);
+        goto state_55;
+    case 37:     /* '{' */
+        token = c->nextToken();
+        PUSH(18, 37, 0, 0);
+        goto state_18;
+    case 39:     /* '}' */
+        goto reduce_37;
+    default:
+        goto error;
+    }
+
+state_38:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 7:     /* '(' */
+    case 12:     /* '++' */
+    case 15:     /* '-' */
+    case 16:     /* '--' */
+    case 20:     /* ';' */
+    case 32:     /* 'if' */
+    case 34:     /* 'return' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto reduce_39;
+    default:
+        goto error;
+    }
+
+state_39:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 7:     /* '(' */
+    case 12:     /* '++' */
+    case 15:     /* '-' */
+    case 16:     /* '--' */
+    case 20:     /* ';' */
+    case 31:     /* 'else' */
+    case 32:     /* 'if' */
+    case 34:     /* 'return' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto reduce_45;
+    default:
+        goto error;
+    }
+
+state_40:
+    switch (token.number) {
+    case 1:     /* '!=' */
+    case 6:     /* '&&' */
+    case 8:     /* ')' */
+    case 14:     /* ',' */
+    case 20:     /* ';' */
+    case 24:     /* '==' */
+    case 28:     /* ']' */
+    case 38:     /* '||' */
+        goto reduce_65;
+    case 21:     /* '<' */
+        token = c->nextToken();
+        PUSH(85, 21, 0, 0);
+        goto state_85;
+    case 22:     /* '<=' */
+        token = c->nextToken();
+        PUSH(84, 22, 0, 0);
+        goto state_84;
+    case 25:     /* '>' */
+        token = c->nextToken();
+        PUSH(83, 25, 0, 0);
+        goto state_83;
+    case 26:     /* '>=' */
+        token = c->nextToken();
+        PUSH(82, 26, 0, 0);
+        goto state_82;
+    default:
+        goto error;
+    }
+
+state_41:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 29:     /* 'eof' */
+    case 30:     /* 'const' */
+    case 31:     /* 'else' */
+    case 32:     /* 'if' */
+    case 33:     /* 'int' */
+    case 34:     /* 'return' */
+    case 35:     /* 'void' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto error;
+    default:
+        goto reduce_85;
+    }
+
+state_42:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 29:     /* 'eof' */
+    case 30:     /* 'const' */
+    case 31:     /* 'else' */
+    case 32:     /* 'if' */
+    case 33:     /* 'int' */
+    case 34:     /* 'return' */
+    case 35:     /* 'void' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto error;
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(89, 7, 0, 0);
+        goto state_89;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(88, 12, 0, 0);
+        goto state_88;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(87, 16, 0, 0);
+        goto state_87;
+    case 27:     /* '[' */
+        token = c->nextToken();
+        PUSH(86, 27, 0, 0);
+        goto state_86;
+    default:
+        goto reduce_80;
+    }
+
+state_43:
+    switch (token.number) {
+    case 39:     /* '}' */
+        token = c->nextToken();
+        PUSH(90, 39, 0, 0);
+        goto state_90;
+    default:
+        goto error;
+    }
+
+state_44:
+    switch (token.number) {
+    case 20:     /* ';' */
+        token = c->nextToken();
+        PUSH(91, 20, 0, 0);
+        goto state_91;
+    default:
+        goto error;
+    }
+
+state_45:
+    switch (token.number) {
+    case 1:     /* '!=' */
+    case 6:     /* '&&' */
+    case 8:     /* ')' */
+    case 11:     /* '+' */
+    case 14:     /* ',' */
+    case 15:     /* '-' */
+    case 20:     /* ';' */
+    case 21:     /* '<' */
+    case 22:     /* '<=' */
+    case 24:     /* '==' */
+    case 25:     /* '>' */
+    case 26:     /* '>=' */
+    case 28:     /* ']' */
+    case 38:     /* '||' */
+        goto reduce_73;
+    case 2:     /* '%' */
+        token = c->nextToken();
+        PUSH(94, 2, 0, 0);
+        goto state_94;
+    case 9:     /* '*' */
+        token = c->nextToken();
+        PUSH(93, 9, 0, 0);
+        goto state_93;
+    case 18:     /* '/' */
+        token = c->nextToken();
+        PUSH(92, 18, 0, 0);
+        goto state_92;
+    default:
+        goto error;
+    }
+
+state_46:
+    switch (token.number) {
+    case 8:     /* ')' */
+    case 14:     /* ',' */
+    case 20:     /* ';' */
+    case 28:     /* ']' */
+        goto reduce_54;
+    case 38:     /* '||' */
+        token = c->nextToken();
+        PUSH(95, 38, 0, 0);
+        goto state_95;
+    default:
+        goto error;
+    }
+
+state_47:
+    switch (token.number) {
+    case 6:     /* '&&' */
+        token = c->nextToken();
+        PUSH(96, 6, 0, 0);
+        goto state_96;
+    case 8:     /* ')' */
+    case 14:     /* ',' */
+    case 20:     /* ';' */
+    case 28:     /* ']' */
+    case 38:     /* '||' */
+        goto reduce_61;
+    default:
+        goto error;
+    }
+
+state_48:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 7:     /* '(' */
+    case 12:     /* '++' */
+    case 15:     /* '-' */
+    case 16:     /* '--' */
+    case 20:     /* ';' */
+    case 31:     /* 'else' */
+    case 32:     /* 'if' */
+    case 34:     /* 'return' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto reduce_43;
+    default:
+        goto error;
+    }
+
+state_49:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 7:     /* '(' */
+    case 12:     /* '++' */
+    case 15:     /* '-' */
+    case 16:     /* '--' */
+    case 20:     /* ';' */
+    case 31:     /* 'else' */
+    case 32:     /* 'if' */
+    case 34:     /* 'return' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto reduce_42;
+    default:
+        goto error;
+    }
+
+state_50:
+    switch (token.number) {
+    case 20:     /* ';' */
+        goto reduce_47;
+    default:
+        goto error;
+    }
+
+state_51:
+    switch (token.number) {
+    case 1:     /* '!=' */
+        token = c->nextToken();
+        PUSH(98, 1, 0, 0);
+        goto state_98;
+    case 6:     /* '&&' */
+    case 8:     /* ')' */
+    case 14:     /* ',' */
+    case 20:     /* ';' */
+    case 28:     /* ']' */
+    case 38:     /* '||' */
+        goto reduce_63;
+    case 24:     /* '==' */
+        token = c->nextToken();
+        PUSH(97, 24, 0, 0);
+        goto state_97;
+    default:
+        goto error;
+    }
+
+state_52:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 7:     /* '(' */
+    case 12:     /* '++' */
+    case 15:     /* '-' */
+    case 16:     /* '--' */
+    case 20:     /* ';' */
+    case 31:     /* 'else' */
+    case 32:     /* 'if' */
+    case 34:     /* 'return' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto reduce_41;
+    default:
+        goto error;
+    }
+
+state_53:
+    switch (token.number) {
+    case 8:     /* ')' */
+    case 20:     /* ';' */
+    case 28:     /* ']' */
+        goto reduce_53;
+    default:
+        goto error;
+    }
+
+state_54:
+    switch (token.number) {
+    case 1:     /* '!=' */
+    case 6:     /* '&&' */
+    case 8:     /* ')' */
+    case 14:     /* ',' */
+    case 20:     /* ';' */
+    case 21:     /* '<' */
+    case 22:     /* '<=' */
+    case 24:     /* '==' */
+    case 25:     /* '>' */
+    case 26:     /* '>=' */
+    case 28:     /* ']' */
+    case 38:     /* '||' */
+        goto reduce_68;
+    case 11:     /* '+' */
+        token = c->nextToken();
+        PUSH(100, 11, 0, 0);
+        goto state_100;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(99, 15, 0, 0);
+        goto state_99;
+    default:
+        goto error;
+    }
+
+state_55:
+    switch (token.number) {
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(101, 7, 0, 0);
+        goto state_101;
+    default:
+        goto error;
+    }
+
+state_56:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, value);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, value);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(102, 70, value, value);
+            goto state_102;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(63, 4, value, value);
+            goto state_63;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, value);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, value);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(102, 70, value, value);
+            goto state_102;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(62, 5, value, value);
+            goto state_62;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    case 20:     /* ';' */
+        goto reduce_48;
+    default:
+        goto error;
+    }
+
+state_57:
+    switch (token.number) {
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(103, 7, 0, 0);
+        goto state_103;
+    default:
+        goto error;
+    }
+
+state_58:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(63, 4, value, value);
+            goto state_63;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        default:
+            PUSH(104, 84, value, value);
+            goto state_104;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(62, 5, value, value);
+            goto state_62;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        default:
+            PUSH(104, 84, value, value);
+            goto state_104;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_59:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(63, 4, value, value);
+            goto state_63;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        default:
+            PUSH(105, 84, value, value);
+            goto state_105;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(62, 5, value, value);
+            goto state_62;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        default:
+            PUSH(105, 84, value, value);
+            goto state_105;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_60:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(63, 4, value, value);
+            goto state_63;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        default:
+            PUSH(106, 84, value, value);
+            goto state_106;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(62, 5, value, value);
+            goto state_62;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        default:
+            PUSH(106, 84, value, value);
+            goto state_106;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_61:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(107, 52, value, value);
+            goto state_107;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, value);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(63, 4, value, value);
+            goto state_63;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(107, 52, value, value);
+            goto state_107;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, value);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(62, 5, value, value);
+            goto state_62;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_62:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 29:     /* 'eof' */
+    case 30:     /* 'const' */
+    case 31:     /* 'else' */
+    case 32:     /* 'if' */
+    case 33:     /* 'int' */
+    case 34:     /* 'return' */
+    case 35:     /* 'void' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto error;
+    default:
+        goto reduce_96;
+    }
+
+state_63:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 29:     /* 'eof' */
+    case 30:     /* 'const' */
+    case 31:     /* 'else' */
+    case 32:     /* 'if' */
+    case 33:     /* 'int' */
+    case 34:     /* 'return' */
+    case 35:     /* 'void' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto error;
+    default:
+        goto reduce_95;
+    }
+
+state_64:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(63, 4, value, value);
+            goto state_63;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        default:
+            PUSH(108, 84, value, value);
+            goto state_108;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(62, 5, value, value);
+            goto state_62;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        default:
+            PUSH(108, 84, value, value);
+            goto state_108;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_65:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 7:     /* '(' */
+    case 12:     /* '++' */
+    case 15:     /* '-' */
+    case 16:     /* '--' */
+    case 20:     /* ';' */
+    case 30:     /* 'const' */
+    case 32:     /* 'if' */
+    case 33:     /* 'int' */
+    case 34:     /* 'return' */
+    case 35:     /* 'void' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto reduce_27;
+    default:
+        goto error;
+    }
+
+state_66:
+    switch (token.number) {
+    case 8:     /* ')' */
+    case 14:     /* ',' */
+    case 20:     /* ';' */
+    case 23:     /* '=' */
+        goto reduce_33;
+    case 27:     /* '[' */
+        token = c->nextToken();
+        PUSH(34, 27, 0, 0);
+        goto state_34;
+    default:
+        goto error;
+    }
+
+state_67:
+    switch (token.number) {
+    case 14:     /* ',' */
+    case 20:     /* ';' */
+        goto reduce_30;
+    default:
+        goto error;
+    }
+
+state_68:
+    switch (token.number) {
+    case 8:     /* ')' */
+    case 14:     /* ',' */
+        goto reduce_20;
+    default:
+        goto error;
+    }
+
+state_69:
+    switch (token.number) {
+    case 8:     /* ')' */
+        token = c->nextToken();
+        PUSH(109, 8, 0, 0);
+        goto state_109;
+    default:
+        goto error;
+    }
+
+state_70:
+    switch (token.number) {
+    case 8:     /* ')' */
+        goto reduce_18;
+    case 14:     /* ',' */
+        token = c->nextToken();
+        PUSH(110, 14, 0, 0);
+        goto state_110;
+    default:
+        goto error;
+    }
+
+state_71:
+    switch (token.number) {
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        PUSH(66, 4, value, value);
+        goto state_66;
+    default:
+        goto error;
+    }
+
+state_72:
+    switch (token.number) {
+    case 14:     /* ',' */
+    case 20:     /* ';' */
+        goto reduce_32;
+    default:
+        goto error;
+    }
+
+state_73:
+    switch (token.number) {
+    case 28:     /* ']' */
+        token = c->nextToken();
+        PUSH(112, 28, 0, 0);
+        goto state_112;
+    default:
+        goto error;
+    }
+
+state_74:
+    switch (token.number) {
+    case 28:     /* ']' */
+        goto reduce_35;
+    default:
+        goto error;
+    }
+
+state_75:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(113, 43, value, value);
+            goto state_113;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(63, 4, value, value);
+            goto state_63;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(113, 43, value, value);
+            goto state_113;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(62, 5, value, value);
+            goto state_62;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_76:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(114, 43, value, value);
+            goto state_114;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(63, 4, value, value);
+            goto state_63;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(114, 43, value, value);
+            goto state_114;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(62, 5, value, value);
+            goto state_62;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_77:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(115, 43, value, value);
+            goto state_115;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(63, 4, value, value);
+            goto state_63;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(115, 43, value, value);
+            goto state_115;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(62, 5, value, value);
+            goto state_62;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_78:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(116, 43, value, value);
+            goto state_116;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(63, 4, value, value);
+            goto state_63;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(116, 43, value, value);
+            goto state_116;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(62, 5, value, value);
+            goto state_62;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_79:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(117, 43, value, value);
+            goto state_117;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(63, 4, value, value);
+            goto state_63;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(117, 43, value, value);
+            goto state_117;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(62, 5, value, value);
+            goto state_62;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_80:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(118, 43, value, value);
+            goto state_118;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(63, 4, value, value);
+            goto state_63;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(118, 43, value, value);
+            goto state_118;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(62, 5, value, value);
+            goto state_62;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_81:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 7:     /* '(' */
+    case 12:     /* '++' */
+    case 15:     /* '-' */
+    case 16:     /* '--' */
+    case 20:     /* ';' */
+    case 32:     /* 'if' */
+    case 34:     /* 'return' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto reduce_40;
+    default:
+        goto error;
+    }
+
+state_82:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(63, 4, value, value);
+            goto state_63;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, value);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        default:
+            PUSH(120, 42, value, value);
+            goto state_120;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(62, 5, value, value);
+            goto state_62;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, value);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        default:
+            PUSH(120, 42, value, value);
+            goto state_120;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_83:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(63, 4, value, value);
+            goto state_63;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, value);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        default:
+            PUSH(121, 42, value, value);
+            goto state_121;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(62, 5, value, value);
+            goto state_62;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, value);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        default:
+            PUSH(121, 42, value, value);
+            goto state_121;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_84:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(63, 4, value, value);
+            goto state_63;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, value);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        default:
+            PUSH(122, 42, value, value);
+            goto state_122;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(62, 5, value, value);
+            goto state_62;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, value);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        default:
+            PUSH(122, 42, value, value);
+            goto state_122;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_85:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(63, 4, value, value);
+            goto state_63;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, value);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        default:
+            PUSH(123, 42, value, value);
+            goto state_123;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(62, 5, value, value);
+            goto state_62;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, value);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        default:
+            PUSH(123, 42, value, value);
+            goto state_123;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_86:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(124, 52, value, value);
+            goto state_124;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, value);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(63, 4, value, value);
+            goto state_63;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(124, 52, value, value);
+            goto state_124;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, value);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(62, 5, value, value);
+            goto state_62;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_87:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 29:     /* 'eof' */
+    case 30:     /* 'const' */
+    case 31:     /* 'else' */
+    case 32:     /* 'if' */
+    case 33:     /* 'int' */
+    case 34:     /* 'return' */
+    case 35:     /* 'void' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto error;
+    default:
+        goto reduce_89;
+    }
+
+state_88:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 29:     /* 'eof' */
+    case 30:     /* 'const' */
+    case 31:     /* 'else' */
+    case 32:     /* 'if' */
+    case 33:     /* 'int' */
+    case 34:     /* 'return' */
+    case 35:     /* 'void' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto error;
+    default:
+        goto reduce_88;
+    }
+
+state_89:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+            PUSH(125, 68, value, value);
+            goto state_125;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(127, 41, value, value);
+            goto state_127;
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(126, 43, value, value);
+            goto state_126;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(63, 4, value, value);
+            goto state_63;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+            PUSH(125, 68, value, value);
+            goto state_125;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(127, 41, value, value);
+            goto state_127;
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(126, 43, value, value);
+            goto state_126;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(62, 5, value, value);
+            goto state_62;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 8:     /* ')' */
+        goto reduce_91;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_90:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 7:     /* '(' */
+    case 12:     /* '++' */
+    case 15:     /* '-' */
+    case 16:     /* '--' */
+    case 20:     /* ';' */
+    case 29:     /* 'eof' */
+    case 30:     /* 'const' */
+    case 31:     /* 'else' */
+    case 32:     /* 'if' */
+    case 33:     /* 'int' */
+    case 34:     /* 'return' */
+    case 35:     /* 'void' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto reduce_23;
+    default:
+        goto error;
+    }
+
+state_91:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 7:     /* '(' */
+    case 12:     /* '++' */
+    case 15:     /* '-' */
+    case 16:     /* '--' */
+    case 20:     /* ';' */
+    case 31:     /* 'else' */
+    case 32:     /* 'if' */
+    case 34:     /* 'return' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto reduce_46;
+    default:
+        goto error;
+    }
+
+state_92:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(63, 4, value, value);
+            goto state_63;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        default:
+            PUSH(129, 84, value, value);
+            goto state_129;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(62, 5, value, value);
+            goto state_62;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        default:
+            PUSH(129, 84, value, value);
+            goto state_129;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_93:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(63, 4, value, value);
+            goto state_63;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        default:
+            PUSH(130, 84, value, value);
+            goto state_130;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(62, 5, value, value);
+            goto state_62;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        default:
+            PUSH(130, 84, value, value);
+            goto state_130;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_94:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(63, 4, value, value);
+            goto state_63;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        default:
+            PUSH(131, 84, value, value);
+            goto state_131;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(62, 5, value, value);
+            goto state_62;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        default:
+            PUSH(131, 84, value, value);
+            goto state_131;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_95:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, value);
+            goto state_119;
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(132, 63, value, value);
+            goto state_132;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        default:
+            PUSH(63, 4, value, value);
+            goto state_63;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, value);
+            goto state_119;
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(132, 63, value, value);
+            goto state_132;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        default:
+            PUSH(62, 5, value, value);
+            goto state_62;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_96:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 24:     /* '==' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(133, 51, value, value);
+            goto state_133;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, value);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        default:
+            PUSH(63, 4, value, value);
+            goto state_63;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 24:     /* '==' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(133, 51, value, value);
+            goto state_133;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, value);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        default:
+            PUSH(62, 5, value, value);
+            goto state_62;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_97:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(134, 77, value, value);
+            goto state_134;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, value);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        default:
+            PUSH(63, 4, value, value);
+            goto state_63;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(134, 77, value, value);
+            goto state_134;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, value);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        default:
+            PUSH(62, 5, value, value);
+            goto state_62;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_98:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(135, 77, value, value);
+            goto state_135;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, value);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        default:
+            PUSH(63, 4, value, value);
+            goto state_63;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(135, 77, value, value);
+            goto state_135;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, value);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        default:
+            PUSH(62, 5, value, value);
+            goto state_62;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_99:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(63, 4, value, value);
+            goto state_63;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, value);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        default:
+            PUSH(136, 67, value, value);
+            goto state_136;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(62, 5, value, value);
+            goto state_62;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, value);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        default:
+            PUSH(136, 67, value, value);
+            goto state_136;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_100:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(63, 4, value, value);
+            goto state_63;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, value);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        default:
+            PUSH(137, 67, value, value);
+            goto state_137;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(62, 5, value, value);
+            goto state_62;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, value);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        default:
+            PUSH(137, 67, value, value);
+            goto state_137;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_101:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(138, 52, value, value);
+            goto state_138;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, value);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(63, 4, value, value);
+            goto state_63;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(138, 52, value, value);
+            goto state_138;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, value);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(62, 5, value, value);
+            goto state_62;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_102:
+    switch (token.number) {
+    case 20:     /* ';' */
+        token = c->nextToken();
+        PUSH(139, 20, 0, 0);
+        goto state_139;
+    default:
+        goto error;
+    }
+
+state_103:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(140, 52, value, value);
+            goto state_140;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, value);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(63, 4, value, value);
+            goto state_63;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(140, 52, value, value);
+            goto state_140;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, value);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(62, 5, value, value);
+            goto state_62;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_104:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 7:     /* '(' */
+    case 12:     /* '++' */
+    case 16:     /* '--' */
+    case 27:     /* '[' */
+    case 29:     /* 'eof' */
+    case 30:     /* 'const' */
+    case 31:     /* 'else' */
+    case 32:     /* 'if' */
+    case 33:     /* 'int' */
+    case 34:     /* 'return' */
+    case 35:     /* 'void' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto error;
+    default:
+        goto reduce_84;
+    }
+
+state_105:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 7:     /* '(' */
+    case 12:     /* '++' */
+    case 16:     /* '--' */
+    case 27:     /* '[' */
+    case 29:     /* 'eof' */
+    case 30:     /* 'const' */
+    case 31:     /* 'else' */
+    case 32:     /* 'if' */
+    case 33:     /* 'int' */
+    case 34:     /* 'return' */
+    case 35:     /* 'void' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto error;
+    default:
+        goto reduce_81;
+    }
+
+state_106:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 7:     /* '(' */
+    case 12:     /* '++' */
+    case 16:     /* '--' */
+    case 27:     /* '[' */
+    case 29:     /* 'eof' */
+    case 30:     /* 'const' */
+    case 31:     /* 'else' */
+    case 32:     /* 'if' */
+    case 33:     /* 'int' */
+    case 34:     /* 'return' */
+    case 35:     /* 'void' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto error;
+    default:
+        goto reduce_83;
+    }
+
+state_107:
+    switch (token.number) {
+    case 8:     /* ')' */
+        token = c->nextToken();
+        PUSH(141, 8, 0, 0);
+        goto state_141;
+    default:
+        goto error;
+    }
+
+state_108:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 7:     /* '(' */
+    case 12:     /* '++' */
+    case 16:     /* '--' */
+    case 27:     /* '[' */
+    case 29:     /* 'eof' */
+    case 30:     /* 'const' */
+    case 31:     /* 'else' */
+    case 32:     /* 'if' */
+    case 33:     /* 'int' */
+    case 34:     /* 'return' */
+    case 35:     /* 'void' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto error;
+    default:
+        goto reduce_82;
+    }
+
+state_109:
+    switch (token.number) {
+    case 37:     /* '{' */
+        goto reduce_17;
+    default:
+        goto error;
+    }
+
+state_110:
+    switch (token.number) {
+    case 30:     /* 'const' */
+        token = c->nextToken();
+        PUSH(14, 30, 0, 0);
+        goto state_14;
+    case 33:     /* 'int' */
+        token = c->nextToken();
+        PUSH(13, 33, 0, 0);
+        goto state_13;
+    case 35:     /* 'void' */
+        token = c->nextToken();
+        PUSH(12, 35, 0, 0);
+        goto state_12;
+    default:
+        goto error;
+    }
+
+state_111:
+    switch (token.number) {
+    case 8:     /* ')' */
+    case 14:     /* ',' */
+        goto reduce_22;
+    default:
+        goto error;
+    }
+
+state_112:
+    switch (token.number) {
+    case 8:     /* ')' */
+    case 14:     /* ',' */
+    case 20:     /* ';' */
+    case 23:     /* '=' */
+        goto reduce_34;
+    default:
+        goto error;
+    }
+
+state_113:
+    switch (token.number) {
+    case 8:     /* ')' */
+    case 14:     /* ',' */
+    case 20:     /* ';' */
+    case 28:     /* ']' */
+        goto reduce_55;
+    default:
+        goto error;
+    }
+
+state_114:
+    switch (token.number) {
+    case 8:     /* ')' */
+    case 14:     /* ',' */
+    case 20:     /* ';' */
+    case 28:     /* ']' */
+        goto reduce_59;
+    default:
+        goto error;
+    }
+
+state_115:
+    switch (token.number) {
+    case 8:     /* ')' */
+    case 14:     /* ',' */
+    case 20:     /* ';' */
+    case 28:     /* ']' */
+        goto reduce_57;
+    default:
+        goto error;
+    }
+
+state_116:
+    switch (token.number) {
+    case 8:     /* ')' */
+    case 14:     /* ',' */
+    case 20:     /* ';' */
+    case 28:     /* ']' */
+        goto reduce_56;
+    default:
+        goto error;
+    }
+
+state_117:
+    switch (token.number) {
+    case 8:     /* ')' */
+    case 14:     /* ',' */
+    case 20:     /* ';' */
+    case 28:     /* ']' */
+        goto reduce_58;
+    default:
+        goto error;
+    }
+
+state_118:
+    switch (token.number) {
+    case 8:     /* ')' */
+    case 14:     /* ',' */
+    case 20:     /* ';' */
+    case 28:     /* ']' */
+        goto reduce_60;
+    default:
+        goto error;
+    }
+
+state_119:
+    switch (token.number) {
+    case 1:     /* '!=' */
+    case 2:     /* '%' */
+    case 6:     /* '&&' */
+    case 8:     /* ')' */
+    case 9:     /* '*' */
+    case 11:     /* '+' */
+    case 14:     /* ',' */
+    case 15:     /* '-' */
+    case 18:     /* '/' */
+    case 20:     /* ';' */
+    case 21:     /* '<' */
+    case 22:     /* '<=' */
+    case 24:     /* '==' */
+    case 25:     /* '>' */
+    case 26:     /* '>=' */
+    case 28:     /* ']' */
+    case 38:     /* '||' */
+        goto reduce_76;
+    default:
+        goto error;
+    }
+
+state_120:
+    switch (token.number) {
+    case 1:     /* '!=' */
+    case 6:     /* '&&' */
+    case 8:     /* ')' */
+    case 14:     /* ',' */
+    case 20:     /* ';' */
+    case 21:     /* '<' */
+    case 22:     /* '<=' */
+    case 24:     /* '==' */
+    case 25:     /* '>' */
+    case 26:     /* '>=' */
+    case 28:     /* ']' */
+    case 38:     /* '||' */
+        goto reduce_71;
+    case 11:     /* '+' */
+        token = c->nextToken();
+        PUSH(100, 11, 0, 0);
+        goto state_100;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(99, 15, 0, 0);
+        goto state_99;
+    default:
+        goto error;
+    }
+
+state_121:
+    switch (token.number) {
+    case 1:     /* '!=' */
+    case 6:     /* '&&' */
+    case 8:     /* ')' */
+    case 14:     /* ',' */
+    case 20:     /* ';' */
+    case 21:     /* '<' */
+    case 22:     /* '<=' */
+    case 24:     /* '==' */
+    case 25:     /* '>' */
+    case 26:     /* '>=' */
+    case 28:     /* ']' */
+    case 38:     /* '||' */
+        goto reduce_69;
+    case 11:     /* '+' */
+        token = c->nextToken();
+        PUSH(100, 11, 0, 0);
+        goto state_100;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(99, 15, 0, 0);
+        goto state_99;
+    default:
+        goto error;
+    }
+
+state_122:
+    switch (token.number) {
+    case 1:     /* '!=' */
+    case 6:     /* '&&' */
+    case 8:     /* ')' */
+    case 14:     /* ',' */
+    case 20:     /* ';' */
+    case 21:     /* '<' */
+    case 22:     /* '<=' */
+    case 24:     /* '==' */
+    case 25:     /* '>' */
+    case 26:     /* '>=' */
+    case 28:     /* ']' */
+    case 38:     /* '||' */
+        goto reduce_72;
+    case 11:     /* '+' */
+        token = c->nextToken();
+        PUSH(100, 11, 0, 0);
+        goto state_100;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(99, 15, 0, 0);
+        goto state_99;
+    default:
+        goto error;
+    }
+
+state_123:
+    switch (token.number) {
+    case 1:     /* '!=' */
+    case 6:     /* '&&' */
+    case 8:     /* ')' */
+    case 14:     /* ',' */
+    case 20:     /* ';' */
+    case 21:     /* '<' */
+    case 22:     /* '<=' */
+    case 24:     /* '==' */
+    case 25:     /* '>' */
+    case 26:     /* '>=' */
+    case 28:     /* ']' */
+    case 38:     /* '||' */
+        goto reduce_70;
+    case 11:     /* '+' */
+        token = c->nextToken();
+        PUSH(100, 11, 0, 0);
+        goto state_100;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(99, 15, 0, 0);
+        goto state_99;
+    default:
+        goto error;
+    }
+
+state_124:
+    switch (token.number) {
+    case 28:     /* ']' */
+        token = c->nextToken();
+        PUSH(143, 28, 0, 0);
+        goto state_143;
+    default:
+        goto error;
+    }
+
+state_125:
+    switch (token.number) {
+    case 8:     /* ')' */
+        token = c->nextToken();
+        PUSH(144, 8, 0, 0);
+        goto state_144;
+    default:
+        goto error;
+    }
+
+state_126:
+    switch (token.number) {
+    case 8:     /* ')' */
+    case 14:     /* ',' */
+        goto reduce_93;
+    default:
+        goto error;
+    }
+
+state_127:
+    switch (token.number) {
+    case 8:     /* ')' */
+        goto reduce_92;
+    case 14:     /* ',' */
+        token = c->nextToken();
+        PUSH(145, 14, 0, 0);
+        goto state_145;
+    default:
+        goto error;
+    }
+
+state_128:
+    switch (token.number) {
+    case 8:     /* ')' */
+        goto reduce_90;
+    default:
+        goto error;
+    }
+
+state_129:
+    switch (token.number) {
+    case 1:     /* '!=' */
+    case 2:     /* '%' */
+    case 6:     /* '&&' */
+    case 8:     /* ')' */
+    case 9:     /* '*' */
+    case 11:     /* '+' */
+    case 14:     /* ',' */
+    case 15:     /* '-' */
+    case 18:     /* '/' */
+    case 20:     /* ';' */
+    case 21:     /* '<' */
+    case 22:     /* '<=' */
+    case 24:     /* '==' */
+    case 25:     /* '>' */
+    case 26:     /* '>=' */
+    case 28:     /* ']' */
+    case 38:     /* '||' */
+        goto reduce_78;
+    default:
+        goto error;
+    }
+
+state_130:
+    switch (token.number) {
+    case 1:     /* '!=' */
+    case 2:     /* '%' */
+    case 6:     /* '&&' */
+    case 8:     /* ')' */
+    case 9:     /* '*' */
+    case 11:     /* '+' */
+    case 14:     /* ',' */
+    case 15:     /* '-' */
+    case 18:     /* '/' */
+    case 20:     /* ';' */
+    case 21:     /* '<' */
+    case 22:     /* '<=' */
+    case 24:     /* '==' */
+    case 25:     /* '>' */
+    case 26:     /* '>=' */
+    case 28:     /* ']' */
+    case 38:     /* '||' */
+        goto reduce_77;
+    default:
+        goto error;
+    }
+
+state_131:
+    switch (token.number) {
+    case 1:     /* '!=' */
+    case 2:     /* '%' */
+    case 6:     /* '&&' */
+    case 8:     /* ')' */
+    case 9:     /* '*' */
+    case 11:     /* '+' */
+    case 14:     /* ',' */
+    case 15:     /* '-' */
+    case 18:     /* '/' */
+    case 20:     /* ';' */
+    case 21:     /* '<' */
+    case 22:     /* '<=' */
+    case 24:     /* '==' */
+    case 25:     /* '>' */
+    case 26:     /* '>=' */
+    case 28:     /* ']' */
+    case 38:     /* '||' */
+        goto reduce_79;
+    default:
+        goto error;
+    }
+
+state_132:
+    switch (token.number) {
+    case 6:     /* '&&' */
+        token = c->nextToken();
+        PUSH(96, 6, 0, 0);
+        goto state_96;
+    case 8:     /* ')' */
+    case 14:     /* ',' */
+    case 20:     /* ';' */
+    case 28:     /* ']' */
+    case 38:     /* '||' */
+        goto reduce_62;
+    default:
+        goto error;
+    }
+
+state_133:
+    switch (token.number) {
+    case 1:     /* '!=' */
+        token = c->nextToken();
+        PUSH(98, 1, 0, 0);
+        goto state_98;
+    case 6:     /* '&&' */
+    case 8:     /* ')' */
+    case 14:     /* ',' */
+    case 20:     /* ';' */
+    case 28:     /* ']' */
+    case 38:     /* '||' */
+        goto reduce_64;
+    case 24:     /* '==' */
+        token = c->nextToken();
+        PUSH(97, 24, 0, 0);
+        goto state_97;
+    default:
+        goto error;
+    }
+
+state_134:
+    switch (token.number) {
+    case 1:     /* '!=' */
+    case 6:     /* '&&' */
+    case 8:     /* ')' */
+    case 14:     /* ',' */
+    case 20:     /* ';' */
+    case 24:     /* '==' */
+    case 28:     /* ']' */
+    case 38:     /* '||' */
+        goto reduce_66;
+    case 21:     /* '<' */
+        token = c->nextToken();
+        PUSH(85, 21, 0, 0);
+        goto state_85;
+    case 22:     /* '<=' */
+        token = c->nextToken();
+        PUSH(84, 22, 0, 0);
+        goto state_84;
+    case 25:     /* '>' */
+        token = c->nextToken();
+        PUSH(83, 25, 0, 0);
+        goto state_83;
+    case 26:     /* '>=' */
+        token = c->nextToken();
+        PUSH(82, 26, 0, 0);
+        goto state_82;
+    default:
+        goto error;
+    }
+
+state_135:
+    switch (token.number) {
+    case 1:     /* '!=' */
+    case 6:     /* '&&' */
+    case 8:     /* ')' */
+    case 14:     /* ',' */
+    case 20:     /* ';' */
+    case 24:     /* '==' */
+    case 28:     /* ']' */
+    case 38:     /* '||' */
+        goto reduce_67;
+    case 21:     /* '<' */
+        token = c->nextToken();
+        PUSH(85, 21, 0, 0);
+        goto state_85;
+    case 22:     /* '<=' */
+        token = c->nextToken();
+        PUSH(84, 22, 0, 0);
+        goto state_84;
+    case 25:     /* '>' */
+        token = c->nextToken();
+        PUSH(83, 25, 0, 0);
+        goto state_83;
+    case 26:     /* '>=' */
+        token = c->nextToken();
+        PUSH(82, 26, 0, 0);
+        goto state_82;
+    default:
+        goto error;
+    }
+
+state_136:
+    switch (token.number) {
+    case 1:     /* '!=' */
+    case 6:     /* '&&' */
+    case 8:     /* ')' */
+    case 11:     /* '+' */
+    case 14:     /* ',' */
+    case 15:     /* '-' */
+    case 20:     /* ';' */
+    case 21:     /* '<' */
+    case 22:     /* '<=' */
+    case 24:     /* '==' */
+    case 25:     /* '>' */
+    case 26:     /* '>=' */
+    case 28:     /* ']' */
+    case 38:     /* '||' */
+        goto reduce_75;
+    case 2:     /* '%' */
+        token = c->nextToken();
+        PUSH(94, 2, 0, 0);
+        goto state_94;
+    case 9:     /* '*' */
+        token = c->nextToken();
+        PUSH(93, 9, 0, 0);
+        goto state_93;
+    case 18:     /* '/' */
+        token = c->nextToken();
+        PUSH(92, 18, 0, 0);
+        goto state_92;
+    default:
+        goto error;
+    }
+
+state_137:
+    switch (token.number) {
+    case 1:     /* '!=' */
+    case 6:     /* '&&' */
+    case 8:     /* ')' */
+    case 11:     /* '+' */
+    case 14:     /* ',' */
+    case 15:     /* '-' */
+    case 20:     /* ';' */
+    case 21:     /* '<' */
+    case 22:     /* '<=' */
+    case 24:     /* '==' */
+    case 25:     /* '>' */
+    case 26:     /* '>=' */
+    case 28:     /* ']' */
+    case 38:     /* '||' */
+        goto reduce_74;
+    case 2:     /* '%' */
+        token = c->nextToken();
+        PUSH(94, 2, 0, 0);
+        goto state_94;
+    case 9:     /* '*' */
+        token = c->nextToken();
+        PUSH(93, 9, 0, 0);
+        goto state_93;
+    case 18:     /* '/' */
+        token = c->nextToken();
+        PUSH(92, 18, 0, 0);
+        goto state_92;
+    default:
+        goto error;
+    }
+
+state_138:
+    switch (token.number) {
+    case 8:     /* ')' */
+        token = c->nextToken();
+        PUSH(146, 8, 0, 0);
+        goto state_146;
+    default:
+        goto error;
+    }
+
+state_139:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 7:     /* '(' */
+    case 12:     /* '++' */
+    case 15:     /* '-' */
+    case 16:     /* '--' */
+    case 20:     /* ';' */
+    case 31:     /* 'else' */
+    case 32:     /* 'if' */
+    case 34:     /* 'return' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto reduce_52;
+    default:
+        goto error;
+    }
+
+state_140:
+    switch (token.number) {
+    case 8:     /* ')' */
+        token = c->nextToken();
+        PUSH(147, 8, 0, 0);
+        goto state_147;
+    default:
+        goto error;
+    }
+
+state_141:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 29:     /* 'eof' */
+    case 30:     /* 'const' */
+    case 31:     /* 'else' */
+    case 32:     /* 'if' */
+    case 33:     /* 'int' */
+    case 34:     /* 'return' */
+    case 35:     /* 'void' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto error;
+    default:
+        goto reduce_97;
+    }
+
+state_142:
+    switch (token.number) {
+    case 8:     /* ')' */
+    case 14:     /* ',' */
+        goto reduce_21;
+    default:
+        goto error;
+    }
+
+state_143:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 29:     /* 'eof' */
+    case 30:     /* 'const' */
+    case 31:     /* 'else' */
+    case 32:     /* 'if' */
+    case 33:     /* 'int' */
+    case 34:     /* 'return' */
+    case 35:     /* 'void' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto error;
+    default:
+        goto reduce_86;
+    }
+
+state_144:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 29:     /* 'eof' */
+    case 30:     /* 'const' */
+    case 31:     /* 'else' */
+    case 32:     /* 'if' */
+    case 33:     /* 'int' */
+    case 34:     /* 'return' */
+    case 35:     /* 'void' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto error;
+    default:
+        goto reduce_87;
+    }
+
+state_145:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(148, 43, value, value);
+            goto state_148;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(63, 4, value, value);
+            goto state_63;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(148, 43, value, value);
+            goto state_148;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(62, 5, value, value);
+            goto state_62;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    default:
+        goto error;
+    }
+
+state_146:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, value);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, value);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, value);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(63, 4, value, value);
+            goto state_63;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, value);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, value);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, value);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(62, 5, value, value);
+            goto state_62;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    case 20:     /* ';' */
+        goto reduce_48;
+    case 32:     /* 'if' */
+        token = c->nextToken();
+        PUSH(57, 32, 0, 0);
+        goto state_57;
+    case 34:     /* 'return' */
+        token = c->nextToken();
+        PUSH(56, 34, 0, 0);
+        goto state_56;
+    case 36:     /* 'while' */
+        token = c->nextToken();
+        PUSH(55, 36, 0, 0);
+        goto state_55;
+    case 37:     /* '{' */
+        token = c->nextToken();
+        PUSH(18, 37, 0, 0);
+        goto state_18;
+    default:
+        goto error;
+    }
+
+state_147:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, value);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, value);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, value);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(63, 4, value, value);
+            goto state_63;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, value);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, value);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, value);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(62, 5, value, value);
+            goto state_62;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    case 20:     /* ';' */
+        goto reduce_48;
+    case 32:     /* 'if' */
+        token = c->nextToken();
+        PUSH(57, 32, 0, 0);
+        goto state_57;
+    case 34:     /* 'return' */
+        token = c->nextToken();
+        PUSH(56, 34, 0, 0);
+        goto state_56;
+    case 36:     /* 'while' */
+        token = c->nextToken();
+        PUSH(55, 36, 0, 0);
+        goto state_55;
+    case 37:     /* '{' */
+        token = c->nextToken();
+        PUSH(18, 37, 0, 0);
+        goto state_18;
+    default:
+        goto error;
+    }
+
+state_148:
+    switch (token.number) {
+    case 8:     /* ')' */
+    case 14:     /* ',' */
+        goto reduce_94;
+    default:
+        goto error;
+    }
+
+state_149:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 7:     /* '(' */
+    case 12:     /* '++' */
+    case 15:     /* '-' */
+    case 16:     /* '--' */
+    case 20:     /* ';' */
+    case 31:     /* 'else' */
+    case 32:     /* 'if' */
+    case 34:     /* 'return' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto reduce_51;
+    default:
+        goto error;
+    }
+
+state_150:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 7:     /* '(' */
+    case 12:     /* '++' */
+    case 15:     /* '-' */
+    case 16:     /* '--' */
+    case 20:     /* ';' */
+    case 32:     /* 'if' */
+    case 34:     /* 'return' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto reduce_49;
+    case 31:     /* 'else' */
+        token = c->nextToken();
+        PUSH(151, 31, 0, 0);
+        goto state_151;
+    default:
+        goto error;
+    }
+
+state_151:
+    switch (token.number) {
+    case 0:     /* '!' */
+        token = c->nextToken();
+        PUSH(64, 0, 0, 0);
+        goto state_64;
+    case 4:     /* 'ident' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, value);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, value);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, value);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(63, 4, value, value);
+            goto state_63;
+        }
+    case 5:     /* '%number' */
+        value = buildNode(token);
+        token = c->nextToken();
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, value);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, value);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, value);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, value);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, value);
+            goto state_42;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, value);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, value);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, value);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, value);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, value);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, value);
+            goto state_46;
+        default:
+            PUSH(62, 5, value, value);
+            goto state_62;
+        }
+    case 7:     /* '(' */
+        token = c->nextToken();
+        PUSH(61, 7, 0, 0);
+        goto state_61;
+    case 12:     /* '++' */
+        token = c->nextToken();
+        PUSH(60, 12, 0, 0);
+        goto state_60;
+    case 15:     /* '-' */
+        token = c->nextToken();
+        PUSH(59, 15, 0, 0);
+        goto state_59;
+    case 16:     /* '--' */
+        token = c->nextToken();
+        PUSH(58, 16, 0, 0);
+        goto state_58;
+    case 20:     /* ';' */
+        goto reduce_48;
+    case 32:     /* 'if' */
+        token = c->nextToken();
+        PUSH(57, 32, 0, 0);
+        goto state_57;
+    case 34:     /* 'return' */
+        token = c->nextToken();
+        PUSH(56, 34, 0, 0);
+        goto state_56;
+    case 36:     /* 'while' */
+        token = c->nextToken();
+        PUSH(55, 36, 0, 0);
+        goto state_55;
+    case 37:     /* '{' */
+        token = c->nextToken();
+        PUSH(18, 37, 0, 0);
+        goto state_18;
+    default:
+        goto error;
+    }
+
+state_152:
+    switch (token.number) {
+    case 0:     /* '!' */
+    case 4:     /* 'ident' */
+    case 5:     /* '%number' */
+    case 7:     /* '(' */
+    case 12:     /* '++' */
+    case 15:     /* '-' */
+    case 16:     /* '--' */
+    case 20:     /* ';' */
+    case 31:     /* 'else' */
+    case 32:     /* 'if' */
+    case 34:     /* 'return' */
+    case 36:     /* 'while' */
+    case 37:     /* '{' */
+    case 39:     /* '}' */
+        goto reduce_50;
+    default:
+        goto error;
+    }
+
+reduce_1:       /* mini_c -> translation_unit => PROGRAM */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = tail = newNode();
+    NODE(value).number = PROGRAM;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 1;
+    goto goto_65;
+
+reduce_2:       /* translation_unit -> external_dcl */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_81;
+
+reduce_3:       /* translation_unit -> translation_unit external_dcl */
+    first = valueStack[sp - 1];
+    last = tailStack[sp - 1];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = first;
+    tail = last;
+    sp -= 2;
+    goto goto_81;
+
+reduce_4:       /* external_dcl -> function_def */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_54;
+
+reduce_5:       /* external_dcl -> declaration */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_54;
+
+reduce_6:       /* function_def -> function_header compound_st => FUNC_DEF */
+    first = valueStack[sp - 1];
+    last = tailStack[sp - 1];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = tail = newNode();
+    NODE(value).number = FUNC_DEF;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 2;
+    goto goto_57;
+
+reduce_7:       /* function_header -> dcl_spec function_name formal_param => FUNC_HEAD */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp - 1])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp - 1];
+    }
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = tail = newNode();
+    NODE(value).number = FUNC_HEAD;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 3;
+    goto goto_58;
+
+reduce_8:       /* dcl_spec -> dcl_specifiers => DCL_SPEC */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = tail = newNode();
+    NODE(value).number = DCL_SPEC;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 1;
+    goto goto_45;
+
+reduce_9:       /* dcl_specifiers -> dcl_specifier */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_47;
+
+reduce_10:       /* dcl_specifiers -> dcl_specifiers dcl_specifier */
+    first = valueStack[sp - 1];
+    last = tailStack[sp - 1];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = first;
+    tail = last;
+    sp -= 2;
+    goto goto_47;
+
+reduce_11:       /* dcl_specifier -> type_qualifier */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_46;
+
+reduce_12:       /* dcl_specifier -> type_specifier */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_46;
+
+reduce_13:       /* type_qualifier -> 'const' => CONST_NODE */
+    first = last = 0;
+    value = tail = newNode();
+    NODE(value).number = CONST_NODE;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 1;
+    goto goto_82;
+
+reduce_14:       /* type_specifier -> 'int' => INT_NODE */
+    first = last = 0;
+    value = tail = newNode();
+    NODE(value).number = INT_NODE;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 1;
+    goto goto_83;
+
+reduce_15:       /* type_specifier -> 'void' => VOID_NODE */
+    first = last = 0;
+    value = tail = newNode();
+    NODE(value).number = VOID_NODE;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 1;
+    goto goto_83;
+
+reduce_16:       /* function_name -> '%ident' */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_59;
+
+reduce_17:       /* formal_param -> '(' opt_formal_param ')' => FORMAL_PARA */
+    first = valueStack[sp - 1];
+    last = tailStack[sp - 1];
+    value = tail = newNode();
+    NODE(value).number = FORMAL_PARA;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 3;
+    goto goto_55;
+
+reduce_18:       /* opt_formal_param -> formal_param_list */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_71;
+
+reduce_19:       /* opt_formal_param -> */
+    first = last = 0;
+    value = first;
+    tail = last;
+    goto goto_71;
+
+reduce_20:       /* formal_param_list -> param_dcl */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_56;
+
+reduce_21:       /* formal_param_list -> formal_param_list ',' param_dcl */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = first;
+    tail = last;
+    sp -= 3;
+    goto goto_56;
+
+reduce_22:       /* param_dcl -> dcl_spec declarator => PARAM_DCL */
+    first = valueStack[sp - 1];
+    last = tailStack[sp - 1];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = tail = newNode();
+    NODE(value).number = PARAM_DCL;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 2;
+    goto goto_74;
+
+reduce_23:       /* compound_st -> '{' opt_dcl_list opt_stat_list '}' => COMPOUND_ST */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp - 1])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp - 1];
+    }
+    value = tail = newNode();
+    NODE(value).number = COMPOUND_ST;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 4;
+    goto goto_44;
+
+reduce_24:       /* opt_dcl_list -> declaration_list => DCL_LIST */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = tail = newNode();
+    NODE(value).number = DCL_LIST;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 1;
+    goto goto_69;
+
+reduce_25:       /* opt_dcl_list -> => DCL_LIST */
+    first = last = 0;
+    value = tail = newNode();
+    NODE(value).number = DCL_LIST;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    goto goto_69;
+
+reduce_26:       /* declaration_list -> declaration */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_49;
+
+reduce_27:       /* declaration_list -> declaration_list declaration */
+    first = valueStack[sp - 1];
+    last = tailStack[sp - 1];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = first;
+    tail = last;
+    sp -= 2;
+    goto goto_49;
+
+reduce_28:       /* declaration -> dcl_spec init_dcl_list ';' => DCL */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp - 1])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp - 1];
+    }
+    value = tail = newNode();
+    NODE(value).number = DCL;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 3;
+    goto goto_48;
+
+reduce_29:       /* init_dcl_list -> init_declarator */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_61;
+
+reduce_30:       /* init_dcl_list -> init_dcl_list ',' init_declarator */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = first;
+    tail = last;
+    sp -= 3;
+    goto goto_61;
+
+reduce_31:       /* init_declarator -> declarator => DCL_ITEM */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = tail = newNode();
+    NODE(value).number = DCL_ITEM;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 1;
+    goto goto_62;
+
+reduce_32:       /* init_declarator -> declarator '=' '%number' => DCL_ITEM */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if (last) NODE(last).brother = valueStack[sp];
+    else first = valueStack[sp];
+    last = tailStack[sp];
+    value = tail = newNode();
+    NODE(value).number = DCL_ITEM;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 3;
+    goto goto_62;
+
+reduce_33:       /* declarator -> '%ident' => SIMPLE_VAR */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = tail = newNode();
+    NODE(value).number = SIMPLE_VAR;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 1;
+    goto goto_50;
+
+reduce_34:       /* declarator -> '%ident' '[' opt_number ']' => ARRAY_VAR */
+    first = valueStack[sp - 3];
+    last = tailStack[sp - 3];
+    if ((value = valueStack[sp - 1])) {
+        NODE(last).brother = value;
+        last = tailStack[sp - 1];
+    }
+    value = tail = newNode();
+    NODE(value).number = ARRAY_VAR;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 4;
+    goto goto_50;
+
+reduce_35:       /* opt_number -> '%number' */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_72;
+
+reduce_36:       /* opt_number -> */
+    first = last = 0;
+    value = first;
+    tail = last;
+    goto goto_72;
+
+reduce_37:       /* opt_stat_list -> statement_list => STAT_LIST */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = tail = newNode();
+    NODE(value).number = STAT_LIST;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 1;
+    goto goto_73;
+
+reduce_38:       /* opt_stat_list -> */
+    first = last = 0;
+    value = first;
+    tail = last;
+    goto goto_73;
+
+reduce_39:       /* statement_list -> statement */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_80;
+
+reduce_40:       /* statement_list -> statement_list statement */
+    first = valueStack[sp - 1];
+    last = tailStack[sp - 1];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = first;
+    tail = last;
+    sp -= 2;
+    goto goto_80;
+
+reduce_41:       /* statement -> compound_st */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_79;
+
+reduce_42:       /* statement -> expression_st */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_79;
+
+reduce_43:       /* statement -> if_st */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_79;
+
+reduce_44:       /* statement -> while_st */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_79;
+
+reduce_45:       /* statement -> return_st */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_79;
+
+reduce_46:       /* expression_st -> opt_expression ';' => EXP_ST */
+    first = valueStack[sp - 1];
+    last = tailStack[sp - 1];
+    value = tail = newNode();
+    NODE(value).number = EXP_ST;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 2;
+    goto goto_53;
+
+reduce_47:       /* opt_expression -> expression */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_70;
+
+reduce_48:       /* opt_expression -> */
+    first = last = 0;
+    value = first;
+    tail = last;
+    goto goto_70;
+
+reduce_49:       /* if_st -> 'if' '(' expression ')' statement => IF_ST */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = tail = newNode();
+    NODE(value).number = IF_ST;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 5;
+    goto goto_60;
+
+reduce_50:       /* if_st -> 'if' '(' expression ')' statement 'else' statement => IF_ELSE_ST */
+    first = valueStack[sp - 4];
+    last = tailStack[sp - 4];
+    if ((value = valueStack[sp - 2])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp - 2];
+    }
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = tail = newNode();
+    NODE(value).number = IF_ELSE_ST;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 7;
+    goto goto_60;
+
+reduce_51:       /* while_st -> 'while' '(' expression ')' statement => WHILE_ST */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = tail = newNode();
+    NODE(value).number = WHILE_ST;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 5;
+    goto goto_85;
+
+reduce_52:       /* return_st -> 'return' opt_expression ';' => RETURN_ST */
+    first = valueStack[sp - 1];
+    last = tailStack[sp - 1];
+    value = tail = newNode();
+    NODE(value).number = RETURN_ST;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 3;
+    goto goto_78;
+
+reduce_53:       /* expression -> assignment_exp */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_52;
+
+reduce_54:       /* assignment_exp -> logical_or_exp */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_43;
+
+reduce_55:       /* assignment_exp -> unary_exp '=' assignment_exp => ASSIGN_OP */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = tail = newNode();
+    NODE(value).number = ASSIGN_OP;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 3;
+    goto goto_43;
+
+reduce_56:       /* assignment_exp -> unary_exp '+=' assignment_exp => ADD_ASSIGN */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = tail = newNode();
+    NODE(value).number = ADD_ASSIGN;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 3;
+    goto goto_43;
+
+reduce_57:       /* assignment_exp -> unary_exp '-=' assignment_exp => SUB_ASSIGN */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = tail = newNode();
+    NODE(value).number = SUB_ASSIGN;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 3;
+    goto goto_43;
+
+reduce_58:       /* assignment_exp -> unary_exp '*=' assignment_exp => MUL_ASSIGN */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = tail = newNode();
+    NODE(value).number = MUL_ASSIGN;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 3;
+    goto goto_43;
+
+reduce_59:       /* assignment_exp -> unary_exp '/=' assignment_exp => DIV_ASSIGN */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = tail = newNode();
+    NODE(value).number = DIV_ASSIGN;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 3;
+    goto goto_43;
+
+reduce_60:       /* assignment_exp -> unary_exp '%=' assignment_exp => MOD_ASSIGN */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = tail = newNode();
+    NODE(value).number = MOD_ASSIGN;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 3;
+    goto goto_43;
+
+reduce_61:       /* logical_or_exp -> logical_and_exp */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_64;
+
+reduce_62:       /* logical_or_exp -> logical_or_exp '||' logical_and_exp => LOGICAL_OR */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = tail = newNode();
+    NODE(value).number = LOGICAL_OR;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 3;
+    goto goto_64;
+
+reduce_63:       /* logical_and_exp -> equality_exp */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_63;
+
+reduce_64:       /* logical_and_exp -> logical_and_exp '&&' equality_exp => LOGICAL_AND */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = tail = newNode();
+    NODE(value).number = LOGICAL_AND;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 3;
+    goto goto_63;
+
+reduce_65:       /* equality_exp -> relational_exp */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_51;
+
+reduce_66:       /* equality_exp -> equality_exp '==' relational_exp => EQ */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = tail = newNode();
+    NODE(value).number = EQ;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 3;
+    goto goto_51;
+
+reduce_67:       /* equality_exp -> equality_exp '!=' relational_exp => NE */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = tail = newNode();
+    NODE(value).number = NE;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 3;
+    goto goto_51;
+
+reduce_68:       /* relational_exp -> additive_exp */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_77;
+
+reduce_69:       /* relational_exp -> relational_exp '>' additive_exp => GT */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = tail = newNode();
+    NODE(value).number = GT;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 3;
+    goto goto_77;
+
+reduce_70:       /* relational_exp -> relational_exp '<' additive_exp => LT */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = tail = newNode();
+    NODE(value).number = LT;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 3;
+    goto goto_77;
+
+reduce_71:       /* relational_exp -> relational_exp '>=' additive_exp => GE */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = tail = newNode();
+    NODE(value).number = GE;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 3;
+    goto goto_77;
+
+reduce_72:       /* relational_exp -> relational_exp '<=' additive_exp => LE */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = tail = newNode();
+    NODE(value).number = LE;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 3;
+    goto goto_77;
+
+reduce_73:       /* additive_exp -> multiplicative_exp */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_42;
+
+reduce_74:       /* additive_exp -> additive_exp '+' multiplicative_exp => ADD */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = tail = newNode();
+    NODE(value).number = ADD;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 3;
+    goto goto_42;
+
+reduce_75:       /* additive_exp -> additive_exp '-' multiplicative_exp => SUB */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = tail = newNode();
+    NODE(value).number = SUB;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 3;
+    goto goto_42;
+
+reduce_76:       /* multiplicative_exp -> unary_exp */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_67;
+
+reduce_77:       /* multiplicative_exp -> multiplicative_exp '*' unary_exp => MUL */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = tail = newNode();
+    NODE(value).number = MUL;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 3;
+    goto goto_67;
+
+reduce_78:       /* multiplicative_exp -> multiplicative_exp '/' unary_exp => DIV */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = tail = newNode();
+    NODE(value).number = DIV;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 3;
+    goto goto_67;
+
+reduce_79:       /* multiplicative_exp -> multiplicative_exp '%' unary_exp => MOD */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = tail = newNode();
+    NODE(value).number = MOD;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 3;
+    goto goto_67;
+
+reduce_80:       /* unary_exp -> postfix_exp */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_84;
+
+reduce_81:       /* unary_exp -> '-' unary_exp => UNARY_MINUS */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = tail = newNode();
+    NODE(value).number = UNARY_MINUS;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 2;
+    goto goto_84;
+
+reduce_82:       /* unary_exp -> '!' unary_exp => LOGICAL_NOT */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = tail = newNode();
+    NODE(value).number = LOGICAL_NOT;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 2;
+    goto goto_84;
+
+reduce_83:       /* unary_exp -> '++' unary_exp => PRE_INC */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = tail = newNode();
+    NODE(value).number = PRE_INC;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 2;
+    goto goto_84;
+
+reduce_84:       /* unary_exp -> '--' unary_exp => PRE_DEC */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = tail = newNode();
+    NODE(value).number = PRE_DEC;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 2;
+    goto goto_84;
+
+reduce_85:       /* postfix_exp -> primary_exp */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_75;
+
+reduce_86:       /* postfix_exp -> postfix_exp '[' expression ']' => INDEX */
+    first = valueStack[sp - 3];
+    last = tailStack[sp - 3];
+    if ((value = valueStack[sp - 1])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp - 1];
+    }
+    value = tail = newNode();
+    NODE(value).number = INDEX;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 4;
+    goto goto_75;
+
+reduce_87:       /* postfix_exp -> postfix_exp '(' opt_actual_param ')' => CALL */
+    first = valueStack[sp - 3];
+    last = tailStack[sp - 3];
+    if ((value = valueStack[sp - 1])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp - 1];
+    }
+    value = tail = newNode();
+    NODE(value).number = CALL;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 4;
+    goto goto_75;
+
+reduce_88:       /* postfix_exp -> postfix_exp '++' => POST_INC */
+    first = valueStack[sp - 1];
+    last = tailStack[sp - 1];
+    value = tail = newNode();
+    NODE(value).number = POST_INC;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 2;
+    goto goto_75;
+
+reduce_89:       /* postfix_exp -> postfix_exp '--' => POST_DEC */
+    first = valueStack[sp - 1];
+    last = tailStack[sp - 1];
+    value = tail = newNode();
+    NODE(value).number = POST_DEC;
+    NODE(value).noderep = nonterm;
+    NODE(value).value = 0;
+    NODE(value).son = first;
+    NODE(value).brother = 0;
+    sp -= 2;
+    goto goto_75;
+
+reduce_90:       /* opt_actual_param -> actual_param */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_68;
+
+reduce_91:       /* opt_actual_param -> */
+    first = last = 0;
+    value = first;
+    tail = last;
+    goto goto_68;
+
+reduce_92:       /* actual_param -> actual_param_list */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_40;
+
+reduce_93:       /* actual_param_list -> assignment_exp */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_41;
+
+reduce_94:       /* actual_param_list -> actual_param_list ',' assignment_exp */
+    first = valueStack[sp - 2];
+    last = tailStack[sp - 2];
+    if ((value = valueStack[sp])) {
+        if (last) NODE(last).brother = value;
+        else first = value;
+        last = tailStack[sp];
+    }
+    value = first;
+    tail = last;
+    sp -= 3;
+    goto goto_41;
+
+reduce_95:       /* primary_exp -> '%ident' */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_76;
+
+reduce_96:       /* primary_exp -> '%number' */
+    first = valueStack[sp];
+    last = tailStack[sp];
+    value = first;
+    tail = last;
+    sp -= 1;
+    goto goto_76;
+
+reduce_97:       /* primary_exp -> '(' expression ')' */
+    first = valueStack[sp - 1];
+    last = tailStack[sp - 1];
+    value = first;
+    tail = last;
+    sp -= 3;
+    goto goto_76;
+
+goto_40:         /* actual_param */
+    switch (stateStack[sp]) {
+    case 89:
+        switch (token.number) {
+        case 8:     /* ')' */
+            PUSH(125, 68, value, tail);
+            goto state_125;
+        default:
+            PUSH(128, 40, value, tail);
+            goto state_128;
+        }
+    default:
+        PUSH(128, 40, value, tail);
+        goto state_128;
+    }
+
+goto_41:         /* actual_param_list */
+    switch (stateStack[sp]) {
+    case 89:
+        switch (token.number) {
+        case 8:     /* ')' */
+            PUSH(125, 68, value, tail);
+            goto state_125;
+        default:
+            PUSH(127, 41, value, tail);
+            goto state_127;
+        }
+    default:
+        PUSH(127, 41, value, tail);
+        goto state_127;
+    }
+
+goto_42:         /* additive_exp */
+    switch (stateStack[sp]) {
+    case 25:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        }
+    case 37:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        }
+    case 56:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(102, 70, value, tail);
+            goto state_102;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        }
+    case 61:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(107, 52, value, tail);
+            goto state_107;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        }
+    case 75:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(113, 43, value, tail);
+            goto state_113;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        }
+    case 76:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(114, 43, value, tail);
+            goto state_114;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        }
+    case 77:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(115, 43, value, tail);
+            goto state_115;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        }
+    case 78:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(116, 43, value, tail);
+            goto state_116;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        }
+    case 79:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(117, 43, value, tail);
+            goto state_117;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        }
+    case 80:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(118, 43, value, tail);
+            goto state_118;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        }
+    case 82:
+        PUSH(120, 42, value, tail);
+        goto state_120;
+    case 83:
+        PUSH(121, 42, value, tail);
+        goto state_121;
+    case 84:
+        PUSH(122, 42, value, tail);
+        goto state_122;
+    case 85:
+        PUSH(123, 42, value, tail);
+        goto state_123;
+    case 86:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(124, 52, value, tail);
+            goto state_124;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        }
+    case 89:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+            PUSH(125, 68, value, tail);
+            goto state_125;
+        case 14:     /* ',' */
+            PUSH(127, 41, value, tail);
+            goto state_127;
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(126, 43, value, tail);
+            goto state_126;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        }
+    case 95:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(132, 63, value, tail);
+            goto state_132;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        default:
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        }
+    case 96:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 24:     /* '==' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(133, 51, value, tail);
+            goto state_133;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        default:
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        }
+    case 97:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(134, 77, value, tail);
+            goto state_134;
+        default:
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        }
+    case 98:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(135, 77, value, tail);
+            goto state_135;
+        default:
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        }
+    case 101:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(138, 52, value, tail);
+            goto state_138;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        }
+    case 103:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(140, 52, value, tail);
+            goto state_140;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        }
+    case 145:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(148, 43, value, tail);
+            goto state_148;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        }
+    case 146:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        }
+    case 147:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        }
+    case 151:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        }
+    default:
+        PUSH(54, 42, value, tail);
+        goto state_54;
+    }
+
+goto_43:         /* assignment_exp */
+    switch (stateStack[sp]) {
+    case 25:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        default:
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        }
+    case 37:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        default:
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        }
+    case 56:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 20:     /* ';' */
+            PUSH(102, 70, value, tail);
+            goto state_102;
+        default:
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        }
+    case 61:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(107, 52, value, tail);
+            goto state_107;
+        default:
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        }
+    case 75:
+        PUSH(113, 43, value, tail);
+        goto state_113;
+    case 76:
+        PUSH(114, 43, value, tail);
+        goto state_114;
+    case 77:
+        PUSH(115, 43, value, tail);
+        goto state_115;
+    case 78:
+        PUSH(116, 43, value, tail);
+        goto state_116;
+    case 79:
+        PUSH(117, 43, value, tail);
+        goto state_117;
+    case 80:
+        PUSH(118, 43, value, tail);
+        goto state_118;
+    case 86:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(124, 52, value, tail);
+            goto state_124;
+        default:
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        }
+    case 89:
+        switch (token.number) {
+        case 8:     /* ')' */
+            PUSH(125, 68, value, tail);
+            goto state_125;
+        case 14:     /* ',' */
+            PUSH(127, 41, value, tail);
+            goto state_127;
+        default:
+            PUSH(126, 43, value, tail);
+            goto state_126;
+        }
+    case 101:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(138, 52, value, tail);
+            goto state_138;
+        default:
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        }
+    case 103:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(140, 52, value, tail);
+            goto state_140;
+        default:
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        }
+    case 145:
+        PUSH(148, 43, value, tail);
+        goto state_148;
+    case 146:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        default:
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        }
+    case 147:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        default:
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        }
+    case 151:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        default:
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        }
+    default:
+        PUSH(53, 43, value, tail);
+        goto state_53;
+    }
+
+goto_44:         /* compound_st */
+    switch (stateStack[sp]) {
+    case 5:
+        PUSH(17, 44, value, tail);
+        goto state_17;
+    case 25:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 32:     /* 'if' */
+        case 34:     /* 'return' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(37, 80, value, tail);
+            goto state_37;
+        case 31:     /* 'else' */
+            PUSH(38, 79, value, tail);
+            goto state_38;
+        default:
+            PUSH(52, 44, value, tail);
+            goto state_52;
+        }
+    case 37:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 34:     /* 'return' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(81, 79, value, tail);
+            goto state_81;
+        default:
+            PUSH(52, 44, value, tail);
+            goto state_52;
+        }
+    case 146:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 34:     /* 'return' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(149, 79, value, tail);
+            goto state_149;
+        default:
+            PUSH(52, 44, value, tail);
+            goto state_52;
+        }
+    case 147:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 34:     /* 'return' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(150, 79, value, tail);
+            goto state_150;
+        default:
+            PUSH(52, 44, value, tail);
+            goto state_52;
+        }
+    case 151:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 34:     /* 'return' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(152, 79, value, tail);
+            goto state_152;
+        default:
+            PUSH(52, 44, value, tail);
+            goto state_52;
+        }
+    default:
+        PUSH(52, 44, value, tail);
+        goto state_52;
+    }
+
+goto_45:         /* dcl_spec */
+    switch (stateStack[sp]) {
+    case 18:
+        PUSH(28, 45, value, tail);
+        goto state_28;
+    case 26:
+        PUSH(28, 45, value, tail);
+        goto state_28;
+    case 32:
+        PUSH(71, 45, value, tail);
+        goto state_71;
+    case 110:
+        PUSH(71, 45, value, tail);
+        goto state_71;
+    default:
+        PUSH(11, 45, value, tail);
+        goto state_11;
+    }
+
+goto_46:         /* dcl_specifier */
+    switch (stateStack[sp]) {
+    case 0:
+        switch (token.number) {
+        case 4:     /* 'ident' */
+        case 30:     /* 'const' */
+        case 33:     /* 'int' */
+        case 35:     /* 'void' */
+            PUSH(9, 47, value, tail);
+            goto state_9;
+        default:
+            PUSH(10, 46, value, tail);
+            goto state_10;
+        }
+    case 3:
+        switch (token.number) {
+        case 4:     /* 'ident' */
+        case 30:     /* 'const' */
+        case 33:     /* 'int' */
+        case 35:     /* 'void' */
+            PUSH(9, 47, value, tail);
+            goto state_9;
+        default:
+            PUSH(10, 46, value, tail);
+            goto state_10;
+        }
+    case 9:
+        PUSH(19, 46, value, tail);
+        goto state_19;
+    case 18:
+        switch (token.number) {
+        case 4:     /* 'ident' */
+        case 30:     /* 'const' */
+        case 33:     /* 'int' */
+        case 35:     /* 'void' */
+            PUSH(9, 47, value, tail);
+            goto state_9;
+        default:
+            PUSH(10, 46, value, tail);
+            goto state_10;
+        }
+    case 26:
+        switch (token.number) {
+        case 4:     /* 'ident' */
+        case 30:     /* 'const' */
+        case 33:     /* 'int' */
+        case 35:     /* 'void' */
+            PUSH(9, 47, value, tail);
+            goto state_9;
+        default:
+            PUSH(10, 46, value, tail);
+            goto state_10;
+        }
+    case 32:
+        switch (token.number) {
+        case 4:     /* 'ident' */
+        case 30:     /* 'const' */
+        case 33:     /* 'int' */
+        case 35:     /* 'void' */
+            PUSH(9, 47, value, tail);
+            goto state_9;
+        default:
+            PUSH(10, 46, value, tail);
+            goto state_10;
+        }
+    case 110:
+        switch (token.number) {
+        case 4:     /* 'ident' */
+        case 30:     /* 'const' */
+        case 33:     /* 'int' */
+        case 35:     /* 'void' */
+            PUSH(9, 47, value, tail);
+            goto state_9;
+        default:
+            PUSH(10, 46, value, tail);
+            goto state_10;
+        }
+    default:
+        PUSH(10, 46, value, tail);
+        goto state_10;
+    }
+
+goto_47:         /* dcl_specifiers */
+    switch (stateStack[sp]) {
+    default:
+        PUSH(9, 47, value, tail);
+        goto state_9;
+    }
+
+goto_48:         /* declaration */
+    switch (stateStack[sp]) {
+    case 0:
+        switch (token.number) {
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 33:     /* 'int' */
+        case 35:     /* 'void' */
+            PUSH(3, 81, value, tail);
+            goto state_3;
+        default:
+            PUSH(8, 48, value, tail);
+            goto state_8;
+        }
+    case 3:
+        switch (token.number) {
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 33:     /* 'int' */
+        case 35:     /* 'void' */
+            PUSH(15, 54, value, tail);
+            goto state_15;
+        default:
+            PUSH(8, 48, value, tail);
+            goto state_8;
+        }
+    case 18:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 30:     /* 'const' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(26, 49, value, tail);
+            goto state_26;
+        default:
+            PUSH(27, 48, value, tail);
+            goto state_27;
+        }
+    case 26:
+        PUSH(65, 48, value, tail);
+        goto state_65;
+    default:
+        PUSH(8, 48, value, tail);
+        goto state_8;
+    }
+
+goto_49:         /* declaration_list */
+    switch (stateStack[sp]) {
+    default:
+        PUSH(26, 49, value, tail);
+        goto state_26;
+    }
+
+goto_50:         /* declarator */
+    switch (stateStack[sp]) {
+    case 71:
+        PUSH(111, 50, value, tail);
+        goto state_111;
+    default:
+        PUSH(23, 50, value, tail);
+        goto state_23;
+    }
+
+goto_51:         /* equality_exp */
+    switch (stateStack[sp]) {
+    case 25:
+        switch (token.number) {
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        }
+    case 37:
+        switch (token.number) {
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        }
+    case 56:
+        switch (token.number) {
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(102, 70, value, tail);
+            goto state_102;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        }
+    case 61:
+        switch (token.number) {
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(107, 52, value, tail);
+            goto state_107;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        }
+    case 75:
+        switch (token.number) {
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(113, 43, value, tail);
+            goto state_113;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        }
+    case 76:
+        switch (token.number) {
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(114, 43, value, tail);
+            goto state_114;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        }
+    case 77:
+        switch (token.number) {
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(115, 43, value, tail);
+            goto state_115;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        }
+    case 78:
+        switch (token.number) {
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(116, 43, value, tail);
+            goto state_116;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        }
+    case 79:
+        switch (token.number) {
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(117, 43, value, tail);
+            goto state_117;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        }
+    case 80:
+        switch (token.number) {
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(118, 43, value, tail);
+            goto state_118;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        }
+    case 86:
+        switch (token.number) {
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(124, 52, value, tail);
+            goto state_124;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        }
+    case 89:
+        switch (token.number) {
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+            PUSH(125, 68, value, tail);
+            goto state_125;
+        case 14:     /* ',' */
+            PUSH(127, 41, value, tail);
+            goto state_127;
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(126, 43, value, tail);
+            goto state_126;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        }
+    case 95:
+        switch (token.number) {
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(132, 63, value, tail);
+            goto state_132;
+        default:
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        }
+    case 96:
+        PUSH(133, 51, value, tail);
+        goto state_133;
+    case 101:
+        switch (token.number) {
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(138, 52, value, tail);
+            goto state_138;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        }
+    case 103:
+        switch (token.number) {
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(140, 52, value, tail);
+            goto state_140;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        }
+    case 145:
+        switch (token.number) {
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(148, 43, value, tail);
+            goto state_148;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        }
+    case 146:
+        switch (token.number) {
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        }
+    case 147:
+        switch (token.number) {
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        }
+    case 151:
+        switch (token.number) {
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        }
+    default:
+        PUSH(51, 51, value, tail);
+        goto state_51;
+    }
+
+goto_52:         /* expression */
+    switch (stateStack[sp]) {
+    case 25:
+        switch (token.number) {
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        default:
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        }
+    case 37:
+        switch (token.number) {
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        default:
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        }
+    case 56:
+        switch (token.number) {
+        case 20:     /* ';' */
+            PUSH(102, 70, value, tail);
+            goto state_102;
+        default:
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        }
+    case 61:
+        PUSH(107, 52, value, tail);
+        goto state_107;
+    case 86:
+        PUSH(124, 52, value, tail);
+        goto state_124;
+    case 101:
+        PUSH(138, 52, value, tail);
+        goto state_138;
+    case 103:
+        PUSH(140, 52, value, tail);
+        goto state_140;
+    case 146:
+        switch (token.number) {
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        default:
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        }
+    case 147:
+        switch (token.number) {
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        default:
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        }
+    case 151:
+        switch (token.number) {
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        default:
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        }
+    default:
+        PUSH(50, 52, value, tail);
+        goto state_50;
+    }
+
+goto_53:         /* expression_st */
+    switch (stateStack[sp]) {
+    case 25:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 32:     /* 'if' */
+        case 34:     /* 'return' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(37, 80, value, tail);
+            goto state_37;
+        case 31:     /* 'else' */
+            PUSH(38, 79, value, tail);
+            goto state_38;
+        default:
+            PUSH(49, 53, value, tail);
+            goto state_49;
+        }
+    case 37:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 34:     /* 'return' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(81, 79, value, tail);
+            goto state_81;
+        default:
+            PUSH(49, 53, value, tail);
+            goto state_49;
+        }
+    case 146:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 34:     /* 'return' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(149, 79, value, tail);
+            goto state_149;
+        default:
+            PUSH(49, 53, value, tail);
+            goto state_49;
+        }
+    case 147:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 34:     /* 'return' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(150, 79, value, tail);
+            goto state_150;
+        default:
+            PUSH(49, 53, value, tail);
+            goto state_49;
+        }
+    case 151:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 34:     /* 'return' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(152, 79, value, tail);
+            goto state_152;
+        default:
+            PUSH(49, 53, value, tail);
+            goto state_49;
+        }
+    default:
+        PUSH(49, 53, value, tail);
+        goto state_49;
+    }
+
+goto_54:         /* external_dcl */
+    switch (stateStack[sp]) {
+    case 0:
+        switch (token.number) {
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 33:     /* 'int' */
+        case 35:     /* 'void' */
+            PUSH(3, 81, value, tail);
+            goto state_3;
+        default:
+            PUSH(7, 54, value, tail);
+            goto state_7;
+        }
+    case 3:
+        PUSH(15, 54, value, tail);
+        goto state_15;
+    default:
+        PUSH(7, 54, value, tail);
+        goto state_7;
+    }
+
+goto_55:         /* formal_param */
+    switch (stateStack[sp]) {
+    default:
+        PUSH(31, 55, value, tail);
+        goto state_31;
+    }
+
+goto_56:         /* formal_param_list */
+    switch (stateStack[sp]) {
+    case 32:
+        switch (token.number) {
+        case 8:     /* ')' */
+            PUSH(69, 71, value, tail);
+            goto state_69;
+        default:
+            PUSH(70, 56, value, tail);
+            goto state_70;
+        }
+    default:
+        PUSH(70, 56, value, tail);
+        goto state_70;
+    }
+
+goto_57:         /* function_def */
+    switch (stateStack[sp]) {
+    case 0:
+        switch (token.number) {
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 33:     /* 'int' */
+        case 35:     /* 'void' */
+            PUSH(3, 81, value, tail);
+            goto state_3;
+        default:
+            PUSH(6, 57, value, tail);
+            goto state_6;
+        }
+    case 3:
+        switch (token.number) {
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 33:     /* 'int' */
+        case 35:     /* 'void' */
+            PUSH(15, 54, value, tail);
+            goto state_15;
+        default:
+            PUSH(6, 57, value, tail);
+            goto state_6;
+        }
+    default:
+        PUSH(6, 57, value, tail);
+        goto state_6;
+    }
+
+goto_58:         /* function_header */
+    switch (stateStack[sp]) {
+    default:
+        PUSH(5, 58, value, tail);
+        goto state_5;
+    }
+
+goto_59:         /* function_name */
+    switch (stateStack[sp]) {
+    default:
+        PUSH(22, 59, value, tail);
+        goto state_22;
+    }
+
+goto_60:         /* if_st */
+    switch (stateStack[sp]) {
+    case 25:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 32:     /* 'if' */
+        case 34:     /* 'return' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(37, 80, value, tail);
+            goto state_37;
+        case 31:     /* 'else' */
+            PUSH(38, 79, value, tail);
+            goto state_38;
+        default:
+            PUSH(48, 60, value, tail);
+            goto state_48;
+        }
+    case 37:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 34:     /* 'return' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(81, 79, value, tail);
+            goto state_81;
+        default:
+            PUSH(48, 60, value, tail);
+            goto state_48;
+        }
+    case 146:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 34:     /* 'return' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(149, 79, value, tail);
+            goto state_149;
+        default:
+            PUSH(48, 60, value, tail);
+            goto state_48;
+        }
+    case 147:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 34:     /* 'return' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(150, 79, value, tail);
+            goto state_150;
+        default:
+            PUSH(48, 60, value, tail);
+            goto state_48;
+        }
+    case 151:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 34:     /* 'return' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(152, 79, value, tail);
+            goto state_152;
+        default:
+            PUSH(48, 60, value, tail);
+            goto state_48;
+        }
+    default:
+        PUSH(48, 60, value, tail);
+        goto state_48;
+    }
+
+goto_61:         /* init_dcl_list */
+    switch (stateStack[sp]) {
+    default:
+        PUSH(21, 61, value, tail);
+        goto state_21;
+    }
+
+goto_62:         /* init_declarator */
+    switch (stateStack[sp]) {
+    case 11:
+        switch (token.number) {
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+            PUSH(21, 61, value, tail);
+            goto state_21;
+        default:
+            PUSH(20, 62, value, tail);
+            goto state_20;
+        }
+    case 28:
+        switch (token.number) {
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+            PUSH(21, 61, value, tail);
+            goto state_21;
+        default:
+            PUSH(20, 62, value, tail);
+            goto state_20;
+        }
+    case 30:
+        PUSH(67, 62, value, tail);
+        goto state_67;
+    default:
+        PUSH(20, 62, value, tail);
+        goto state_20;
+    }
+
+goto_63:         /* logical_and_exp */
+    switch (stateStack[sp]) {
+    case 25:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        }
+    case 37:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        }
+    case 56:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(102, 70, value, tail);
+            goto state_102;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        }
+    case 61:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(107, 52, value, tail);
+            goto state_107;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        }
+    case 75:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(113, 43, value, tail);
+            goto state_113;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        }
+    case 76:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(114, 43, value, tail);
+            goto state_114;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        }
+    case 77:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(115, 43, value, tail);
+            goto state_115;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        }
+    case 78:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(116, 43, value, tail);
+            goto state_116;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        }
+    case 79:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(117, 43, value, tail);
+            goto state_117;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        }
+    case 80:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(118, 43, value, tail);
+            goto state_118;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        }
+    case 86:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(124, 52, value, tail);
+            goto state_124;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        }
+    case 89:
+        switch (token.number) {
+        case 8:     /* ')' */
+            PUSH(125, 68, value, tail);
+            goto state_125;
+        case 14:     /* ',' */
+            PUSH(127, 41, value, tail);
+            goto state_127;
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(126, 43, value, tail);
+            goto state_126;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        }
+    case 95:
+        PUSH(132, 63, value, tail);
+        goto state_132;
+    case 101:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(138, 52, value, tail);
+            goto state_138;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        }
+    case 103:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(140, 52, value, tail);
+            goto state_140;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        }
+    case 145:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(148, 43, value, tail);
+            goto state_148;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        }
+    case 146:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        }
+    case 147:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        }
+    case 151:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        }
+    default:
+        PUSH(47, 63, value, tail);
+        goto state_47;
+    }
+
+goto_64:         /* logical_or_exp */
+    switch (stateStack[sp]) {
+    case 25:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        default:
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        }
+    case 37:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        default:
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        }
+    case 56:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(102, 70, value, tail);
+            goto state_102;
+        default:
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        }
+    case 61:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(107, 52, value, tail);
+            goto state_107;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        default:
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        }
+    case 75:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(113, 43, value, tail);
+            goto state_113;
+        default:
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        }
+    case 76:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(114, 43, value, tail);
+            goto state_114;
+        default:
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        }
+    case 77:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(115, 43, value, tail);
+            goto state_115;
+        default:
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        }
+    case 78:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(116, 43, value, tail);
+            goto state_116;
+        default:
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        }
+    case 79:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(117, 43, value, tail);
+            goto state_117;
+        default:
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        }
+    case 80:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(118, 43, value, tail);
+            goto state_118;
+        default:
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        }
+    case 86:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(124, 52, value, tail);
+            goto state_124;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        default:
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        }
+    case 89:
+        switch (token.number) {
+        case 8:     /* ')' */
+            PUSH(125, 68, value, tail);
+            goto state_125;
+        case 14:     /* ',' */
+            PUSH(127, 41, value, tail);
+            goto state_127;
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(126, 43, value, tail);
+            goto state_126;
+        default:
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        }
+    case 101:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(138, 52, value, tail);
+            goto state_138;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        default:
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        }
+    case 103:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(140, 52, value, tail);
+            goto state_140;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        default:
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        }
+    case 145:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(148, 43, value, tail);
+            goto state_148;
+        default:
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        }
+    case 146:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        default:
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        }
+    case 147:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        default:
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        }
+    case 151:
+        switch (token.number) {
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        default:
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        }
+    default:
+        PUSH(46, 64, value, tail);
+        goto state_46;
+    }
+
+goto_65:         /* mini_c */
+    switch (stateStack[sp]) {
+    default:
+        PUSH(4, 65, value, tail);
+        goto state_4;
+    }
+
+goto_67:         /* multiplicative_exp */
+    switch (stateStack[sp]) {
+    case 25:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        }
+    case 37:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        }
+    case 56:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(102, 70, value, tail);
+            goto state_102;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        }
+    case 61:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(107, 52, value, tail);
+            goto state_107;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        }
+    case 75:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(113, 43, value, tail);
+            goto state_113;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        }
+    case 76:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(114, 43, value, tail);
+            goto state_114;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        }
+    case 77:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(115, 43, value, tail);
+            goto state_115;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        }
+    case 78:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(116, 43, value, tail);
+            goto state_116;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        }
+    case 79:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(117, 43, value, tail);
+            goto state_117;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        }
+    case 80:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(118, 43, value, tail);
+            goto state_118;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        }
+    case 82:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 11:     /* '+' */
+        case 14:     /* ',' */
+        case 15:     /* '-' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(120, 42, value, tail);
+            goto state_120;
+        default:
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        }
+    case 83:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 11:     /* '+' */
+        case 14:     /* ',' */
+        case 15:     /* '-' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(121, 42, value, tail);
+            goto state_121;
+        default:
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        }
+    case 84:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 11:     /* '+' */
+        case 14:     /* ',' */
+        case 15:     /* '-' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(122, 42, value, tail);
+            goto state_122;
+        default:
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        }
+    case 85:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 11:     /* '+' */
+        case 14:     /* ',' */
+        case 15:     /* '-' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(123, 42, value, tail);
+            goto state_123;
+        default:
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        }
+    case 86:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(124, 52, value, tail);
+            goto state_124;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        }
+    case 89:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+            PUSH(125, 68, value, tail);
+            goto state_125;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(127, 41, value, tail);
+            goto state_127;
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(126, 43, value, tail);
+            goto state_126;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        }
+    case 95:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(132, 63, value, tail);
+            goto state_132;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        default:
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        }
+    case 96:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 24:     /* '==' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(133, 51, value, tail);
+            goto state_133;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        default:
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        }
+    case 97:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(134, 77, value, tail);
+            goto state_134;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        default:
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        }
+    case 98:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(135, 77, value, tail);
+            goto state_135;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        default:
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        }
+    case 99:
+        PUSH(136, 67, value, tail);
+        goto state_136;
+    case 100:
+        PUSH(137, 67, value, tail);
+        goto state_137;
+    case 101:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(138, 52, value, tail);
+            goto state_138;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        }
+    case 103:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(140, 52, value, tail);
+            goto state_140;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        }
+    case 145:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(148, 43, value, tail);
+            goto state_148;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        }
+    case 146:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        }
+    case 147:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        }
+    case 151:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        }
+    default:
+        PUSH(45, 67, value, tail);
+        goto state_45;
+    }
+
+goto_68:         /* opt_actual_param */
+    switch (stateStack[sp]) {
+    default:
+        PUSH(125, 68, value, tail);
+        goto state_125;
+    }
+
+goto_69:         /* opt_dcl_list */
+    switch (stateStack[sp]) {
+    default:
+        PUSH(25, 69, value, tail);
+        goto state_25;
+    }
+
+goto_70:         /* opt_expression */
+    switch (stateStack[sp]) {
+    case 56:
+        PUSH(102, 70, value, tail);
+        goto state_102;
+    default:
+        PUSH(44, 70, value, tail);
+        goto state_44;
+    }
+
+goto_71:         /* opt_formal_param */
+    switch (stateStack[sp]) {
+    default:
+        PUSH(69, 71, value, tail);
+        goto state_69;
+    }
+
+goto_72:         /* opt_number */
+    switch (stateStack[sp]) {
+    default:
+        PUSH(73, 72, value, tail);
+        goto state_73;
+    }
+
+goto_73:         /* opt_stat_list */
+    switch (stateStack[sp]) {
+    default:
+        PUSH(43, 73, value, tail);
+        goto state_43;
+    }
+
+goto_74:         /* param_dcl */
+    switch (stateStack[sp]) {
+    case 32:
+        switch (token.number) {
+        case 8:     /* ')' */
+            PUSH(69, 71, value, tail);
+            goto state_69;
+        case 14:     /* ',' */
+            PUSH(70, 56, value, tail);
+            goto state_70;
+        default:
+            PUSH(68, 74, value, tail);
+            goto state_68;
+        }
+    case 110:
+        PUSH(142, 74, value, tail);
+        goto state_142;
+    default:
+        PUSH(68, 74, value, tail);
+        goto state_68;
+    }
+
+goto_75:         /* postfix_exp */
+    switch (stateStack[sp]) {
+    case 25:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 37:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 56:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(102, 70, value, tail);
+            goto state_102;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 58:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        default:
+            PUSH(104, 84, value, tail);
+            goto state_104;
+        }
+    case 59:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        default:
+            PUSH(105, 84, value, tail);
+            goto state_105;
+        }
+    case 60:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        default:
+            PUSH(106, 84, value, tail);
+            goto state_106;
+        }
+    case 61:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(107, 52, value, tail);
+            goto state_107;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 64:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        default:
+            PUSH(108, 84, value, tail);
+            goto state_108;
+        }
+    case 75:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(113, 43, value, tail);
+            goto state_113;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 76:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(114, 43, value, tail);
+            goto state_114;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 77:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(115, 43, value, tail);
+            goto state_115;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 78:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(116, 43, value, tail);
+            goto state_116;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 79:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(117, 43, value, tail);
+            goto state_117;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 80:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(118, 43, value, tail);
+            goto state_118;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 82:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 11:     /* '+' */
+        case 14:     /* ',' */
+        case 15:     /* '-' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(120, 42, value, tail);
+            goto state_120;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 83:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 11:     /* '+' */
+        case 14:     /* ',' */
+        case 15:     /* '-' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(121, 42, value, tail);
+            goto state_121;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 84:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 11:     /* '+' */
+        case 14:     /* ',' */
+        case 15:     /* '-' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(122, 42, value, tail);
+            goto state_122;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 85:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 11:     /* '+' */
+        case 14:     /* ',' */
+        case 15:     /* '-' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(123, 42, value, tail);
+            goto state_123;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 86:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(124, 52, value, tail);
+            goto state_124;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 89:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+            PUSH(125, 68, value, tail);
+            goto state_125;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(127, 41, value, tail);
+            goto state_127;
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(126, 43, value, tail);
+            goto state_126;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 92:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        default:
+            PUSH(129, 84, value, tail);
+            goto state_129;
+        }
+    case 93:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        default:
+            PUSH(130, 84, value, tail);
+            goto state_130;
+        }
+    case 94:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        default:
+            PUSH(131, 84, value, tail);
+            goto state_131;
+        }
+    case 95:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(132, 63, value, tail);
+            goto state_132;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 96:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 24:     /* '==' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(133, 51, value, tail);
+            goto state_133;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 97:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(134, 77, value, tail);
+            goto state_134;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 98:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(135, 77, value, tail);
+            goto state_135;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 99:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 2:     /* '%' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 9:     /* '*' */
+        case 11:     /* '+' */
+        case 14:     /* ',' */
+        case 15:     /* '-' */
+        case 18:     /* '/' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(136, 67, value, tail);
+            goto state_136;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 100:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 2:     /* '%' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 9:     /* '*' */
+        case 11:     /* '+' */
+        case 14:     /* ',' */
+        case 15:     /* '-' */
+        case 18:     /* '/' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(137, 67, value, tail);
+            goto state_137;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 101:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(138, 52, value, tail);
+            goto state_138;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 103:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(140, 52, value, tail);
+            goto state_140;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 145:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(148, 43, value, tail);
+            goto state_148;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 146:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 147:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    case 151:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        }
+    default:
+        PUSH(42, 75, value, tail);
+        goto state_42;
+    }
+
+goto_76:         /* primary_exp */
+    switch (stateStack[sp]) {
+    case 25:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        }
+    case 37:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        }
+    case 56:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(102, 70, value, tail);
+            goto state_102;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        }
+    case 58:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        default:
+            PUSH(104, 84, value, tail);
+            goto state_104;
+        }
+    case 59:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        default:
+            PUSH(105, 84, value, tail);
+            goto state_105;
+        }
+    case 60:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        default:
+            PUSH(106, 84, value, tail);
+            goto state_106;
+        }
+    case 61:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(107, 52, value, tail);
+            goto state_107;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        }
+    case 64:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        default:
+            PUSH(108, 84, value, tail);
+            goto state_108;
+        }
+    case 75:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(113, 43, value, tail);
+            goto state_113;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        }
+    case 76:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(114, 43, value, tail);
+            goto state_114;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        }
+    case 77:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(115, 43, value, tail);
+            goto state_115;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        }
+    case 78:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(116, 43, value, tail);
+            goto state_116;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        }
+    case 79:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(117, 43, value, tail);
+            goto state_117;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        }
+    case 80:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(118, 43, value, tail);
+            goto state_118;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        }
+    case 82:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        default:
+            PUSH(120, 42, value, tail);
+            goto state_120;
+        }
+    case 83:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        default:
+            PUSH(121, 42, value, tail);
+            goto state_121;
+        }
+    case 84:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        default:
+            PUSH(122, 42, value, tail);
+            goto state_122;
+        }
+    case 85:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        default:
+            PUSH(123, 42, value, tail);
+            goto state_123;
+        }
+    case 86:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(124, 52, value, tail);
+            goto state_124;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        }
+    case 89:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        case 8:     /* ')' */
+            PUSH(125, 68, value, tail);
+            goto state_125;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(127, 41, value, tail);
+            goto state_127;
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(126, 43, value, tail);
+            goto state_126;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        }
+    case 92:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        default:
+            PUSH(129, 84, value, tail);
+            goto state_129;
+        }
+    case 93:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        default:
+            PUSH(130, 84, value, tail);
+            goto state_130;
+        }
+    case 94:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        default:
+            PUSH(131, 84, value, tail);
+            goto state_131;
+        }
+    case 95:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(132, 63, value, tail);
+            goto state_132;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        default:
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        }
+    case 96:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 24:     /* '==' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(133, 51, value, tail);
+            goto state_133;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        default:
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        }
+    case 97:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(134, 77, value, tail);
+            goto state_134;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        default:
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        }
+    case 98:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(135, 77, value, tail);
+            goto state_135;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        default:
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        }
+    case 99:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        default:
+            PUSH(136, 67, value, tail);
+            goto state_136;
+        }
+    case 100:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 29:     /* 'eof' */
+        case 30:     /* 'const' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 33:     /* 'int' */
+        case 34:     /* 'return' */
+        case 35:     /* 'void' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        default:
+            PUSH(137, 67, value, tail);
+            goto state_137;
+        }
+    case 101:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(138, 52, value, tail);
+            goto state_138;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        }
+    case 103:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(140, 52, value, tail);
+            goto state_140;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        }
+    case 145:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(148, 43, value, tail);
+            goto state_148;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        }
+    case 146:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        }
+    case 147:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        }
+    case 151:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 3:     /* '%=' */
+        case 10:     /* '*=' */
+        case 13:     /* '+=' */
+        case 17:     /* '-=' */
+        case 19:     /* '/=' */
+        case 23:     /* '=' */
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 16:     /* '--' */
+        case 27:     /* '[' */
+            PUSH(42, 75, value, tail);
+            goto state_42;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(41, 76, value, tail);
+            goto state_41;
+        }
+    default:
+        PUSH(41, 76, value, tail);
+        goto state_41;
+    }
+
+goto_77:         /* relational_exp */
+    switch (stateStack[sp]) {
+    case 25:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        }
+    case 37:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        }
+    case 56:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(102, 70, value, tail);
+            goto state_102;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        }
+    case 61:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(107, 52, value, tail);
+            goto state_107;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        }
+    case 75:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(113, 43, value, tail);
+            goto state_113;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        }
+    case 76:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(114, 43, value, tail);
+            goto state_114;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        }
+    case 77:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(115, 43, value, tail);
+            goto state_115;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        }
+    case 78:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(116, 43, value, tail);
+            goto state_116;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        }
+    case 79:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(117, 43, value, tail);
+            goto state_117;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        }
+    case 80:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(118, 43, value, tail);
+            goto state_118;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        }
+    case 86:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(124, 52, value, tail);
+            goto state_124;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        }
+    case 89:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+            PUSH(125, 68, value, tail);
+            goto state_125;
+        case 14:     /* ',' */
+            PUSH(127, 41, value, tail);
+            goto state_127;
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(126, 43, value, tail);
+            goto state_126;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        }
+    case 95:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(132, 63, value, tail);
+            goto state_132;
+        default:
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        }
+    case 96:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 24:     /* '==' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(133, 51, value, tail);
+            goto state_133;
+        default:
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        }
+    case 97:
+        PUSH(134, 77, value, tail);
+        goto state_134;
+    case 98:
+        PUSH(135, 77, value, tail);
+        goto state_135;
+    case 101:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(138, 52, value, tail);
+            goto state_138;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        }
+    case 103:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(140, 52, value, tail);
+            goto state_140;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        }
+    case 145:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(148, 43, value, tail);
+            goto state_148;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        }
+    case 146:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        }
+    case 147:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        }
+    case 151:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        }
+    default:
+        PUSH(40, 77, value, tail);
+        goto state_40;
+    }
+
+goto_78:         /* return_st */
+    switch (stateStack[sp]) {
+    case 25:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 32:     /* 'if' */
+        case 34:     /* 'return' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(37, 80, value, tail);
+            goto state_37;
+        case 31:     /* 'else' */
+            PUSH(38, 79, value, tail);
+            goto state_38;
+        default:
+            PUSH(39, 78, value, tail);
+            goto state_39;
+        }
+    case 37:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 34:     /* 'return' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(81, 79, value, tail);
+            goto state_81;
+        default:
+            PUSH(39, 78, value, tail);
+            goto state_39;
+        }
+    case 146:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 34:     /* 'return' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(149, 79, value, tail);
+            goto state_149;
+        default:
+            PUSH(39, 78, value, tail);
+            goto state_39;
+        }
+    case 147:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 34:     /* 'return' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(150, 79, value, tail);
+            goto state_150;
+        default:
+            PUSH(39, 78, value, tail);
+            goto state_39;
+        }
+    case 151:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 34:     /* 'return' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(152, 79, value, tail);
+            goto state_152;
+        default:
+            PUSH(39, 78, value, tail);
+            goto state_39;
+        }
+    default:
+        PUSH(39, 78, value, tail);
+        goto state_39;
+    }
+
+goto_79:         /* statement */
+    switch (stateStack[sp]) {
+    case 25:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 32:     /* 'if' */
+        case 34:     /* 'return' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(37, 80, value, tail);
+            goto state_37;
+        default:
+            PUSH(38, 79, value, tail);
+            goto state_38;
+        }
+    case 37:
+        PUSH(81, 79, value, tail);
+        goto state_81;
+    case 146:
+        PUSH(149, 79, value, tail);
+        goto state_149;
+    case 147:
+        PUSH(150, 79, value, tail);
+        goto state_150;
+    case 151:
+        PUSH(152, 79, value, tail);
+        goto state_152;
+    default:
+        PUSH(38, 79, value, tail);
+        goto state_38;
+    }
+
+goto_80:         /* statement_list */
+    switch (stateStack[sp]) {
+    default:
+        PUSH(37, 80, value, tail);
+        goto state_37;
+    }
+
+goto_81:         /* translation_unit */
+    switch (stateStack[sp]) {
+    default:
+        PUSH(3, 81, value, tail);
+        goto state_3;
+    }
+
+goto_82:         /* type_qualifier */
+    switch (stateStack[sp]) {
+    case 0:
+        switch (token.number) {
+        case 4:     /* 'ident' */
+        case 30:     /* 'const' */
+        case 33:     /* 'int' */
+        case 35:     /* 'void' */
+            PUSH(9, 47, value, tail);
+            goto state_9;
+        default:
+            PUSH(2, 82, value, tail);
+            goto state_2;
+        }
+    case 3:
+        switch (token.number) {
+        case 4:     /* 'ident' */
+        case 30:     /* 'const' */
+        case 33:     /* 'int' */
+        case 35:     /* 'void' */
+            PUSH(9, 47, value, tail);
+            goto state_9;
+        default:
+            PUSH(2, 82, value, tail);
+            goto state_2;
+        }
+    case 9:
+        switch (token.number) {
+        case 4:     /* 'ident' */
+        case 30:     /* 'const' */
+        case 33:     /* 'int' */
+        case 35:     /* 'void' */
+            PUSH(19, 46, value, tail);
+            goto state_19;
+        default:
+            PUSH(2, 82, value, tail);
+            goto state_2;
+        }
+    case 18:
+        switch (token.number) {
+        case 4:     /* 'ident' */
+        case 30:     /* 'const' */
+        case 33:     /* 'int' */
+        case 35:     /* 'void' */
+            PUSH(9, 47, value, tail);
+            goto state_9;
+        default:
+            PUSH(2, 82, value, tail);
+            goto state_2;
+        }
+    case 26:
+        switch (token.number) {
+        case 4:     /* 'ident' */
+        case 30:     /* 'const' */
+        case 33:     /* 'int' */
+        case 35:     /* 'void' */
+            PUSH(9, 47, value, tail);
+            goto state_9;
+        default:
+            PUSH(2, 82, value, tail);
+            goto state_2;
+        }
+    case 32:
+        switch (token.number) {
+        case 4:     /* 'ident' */
+        case 30:     /* 'const' */
+        case 33:     /* 'int' */
+        case 35:     /* 'void' */
+            PUSH(9, 47, value, tail);
+            goto state_9;
+        default:
+            PUSH(2, 82, value, tail);
+            goto state_2;
+        }
+    case 110:
+        switch (token.number) {
+        case 4:     /* 'ident' */
+        case 30:     /* 'const' */
+        case 33:     /* 'int' */
+        case 35:     /* 'void' */
+            PUSH(9, 47, value, tail);
+            goto state_9;
+        default:
+            PUSH(2, 82, value, tail);
+            goto state_2;
+        }
+    default:
+        PUSH(2, 82, value, tail);
+        goto state_2;
+    }
+
+goto_83:         /* type_specifier */
+    switch (stateStack[sp]) {
+    case 0:
+        switch (token.number) {
+        case 4:     /* 'ident' */
+        case 30:     /* 'const' */
+        case 33:     /* 'int' */
+        case 35:     /* 'void' */
+            PUSH(9, 47, value, tail);
+            goto state_9;
+        default:
+            PUSH(1, 83, value, tail);
+            goto state_1;
+        }
+    case 3:
+        switch (token.number) {
+        case 4:     /* 'ident' */
+        case 30:     /* 'const' */
+        case 33:     /* 'int' */
+        case 35:     /* 'void' */
+            PUSH(9, 47, value, tail);
+            goto state_9;
+        default:
+            PUSH(1, 83, value, tail);
+            goto state_1;
+        }
+    case 9:
+        switch (token.number) {
+        case 4:     /* 'ident' */
+        case 30:     /* 'const' */
+        case 33:     /* 'int' */
+        case 35:     /* 'void' */
+            PUSH(19, 46, value, tail);
+            goto state_19;
+        default:
+            PUSH(1, 83, value, tail);
+            goto state_1;
+        }
+    case 18:
+        switch (token.number) {
+        case 4:     /* 'ident' */
+        case 30:     /* 'const' */
+        case 33:     /* 'int' */
+        case 35:     /* 'void' */
+            PUSH(9, 47, value, tail);
+            goto state_9;
+        default:
+            PUSH(1, 83, value, tail);
+            goto state_1;
+        }
+    case 26:
+        switch (token.number) {
+        case 4:     /* 'ident' */
+        case 30:     /* 'const' */
+        case 33:     /* 'int' */
+        case 35:     /* 'void' */
+            PUSH(9, 47, value, tail);
+            goto state_9;
+        default:
+            PUSH(1, 83, value, tail);
+            goto state_1;
+        }
+    case 32:
+        switch (token.number) {
+        case 4:     /* 'ident' */
+        case 30:     /* 'const' */
+        case 33:     /* 'int' */
+        case 35:     /* 'void' */
+            PUSH(9, 47, value, tail);
+            goto state_9;
+        default:
+            PUSH(1, 83, value, tail);
+            goto state_1;
+        }
+    case 110:
+        switch (token.number) {
+        case 4:     /* 'ident' */
+        case 30:     /* 'const' */
+        case 33:     /* 'int' */
+        case 35:     /* 'void' */
+            PUSH(9, 47, value, tail);
+            goto state_9;
+        default:
+            PUSH(1, 83, value, tail);
+            goto state_1;
+        }
+    default:
+        PUSH(1, 83, value, tail);
+        goto state_1;
+    }
+
+goto_84:         /* unary_exp */
+    switch (stateStack[sp]) {
+    case 25:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        }
+    case 37:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        }
+    case 56:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(102, 70, value, tail);
+            goto state_102;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        }
+    case 58:
+        PUSH(104, 84, value, tail);
+        goto state_104;
+    case 59:
+        PUSH(105, 84, value, tail);
+        goto state_105;
+    case 60:
+        PUSH(106, 84, value, tail);
+        goto state_106;
+    case 61:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(107, 52, value, tail);
+            goto state_107;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        }
+    case 64:
+        PUSH(108, 84, value, tail);
+        goto state_108;
+    case 75:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(113, 43, value, tail);
+            goto state_113;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        }
+    case 76:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(114, 43, value, tail);
+            goto state_114;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        }
+    case 77:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(115, 43, value, tail);
+            goto state_115;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        }
+    case 78:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(116, 43, value, tail);
+            goto state_116;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        }
+    case 79:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(117, 43, value, tail);
+            goto state_117;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        }
+    case 80:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(118, 43, value, tail);
+            goto state_118;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        }
+    case 82:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 11:     /* '+' */
+        case 14:     /* ',' */
+        case 15:     /* '-' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(120, 42, value, tail);
+            goto state_120;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        default:
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        }
+    case 83:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 11:     /* '+' */
+        case 14:     /* ',' */
+        case 15:     /* '-' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(121, 42, value, tail);
+            goto state_121;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        default:
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        }
+    case 84:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 11:     /* '+' */
+        case 14:     /* ',' */
+        case 15:     /* '-' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(122, 42, value, tail);
+            goto state_122;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        default:
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        }
+    case 85:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 11:     /* '+' */
+        case 14:     /* ',' */
+        case 15:     /* '-' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(123, 42, value, tail);
+            goto state_123;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        default:
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        }
+    case 86:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(124, 52, value, tail);
+            goto state_124;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        }
+    case 89:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+            PUSH(125, 68, value, tail);
+            goto state_125;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(127, 41, value, tail);
+            goto state_127;
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(126, 43, value, tail);
+            goto state_126;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        }
+    case 92:
+        PUSH(129, 84, value, tail);
+        goto state_129;
+    case 93:
+        PUSH(130, 84, value, tail);
+        goto state_130;
+    case 94:
+        PUSH(131, 84, value, tail);
+        goto state_131;
+    case 95:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(132, 63, value, tail);
+            goto state_132;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        default:
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        }
+    case 96:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 24:     /* '==' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(133, 51, value, tail);
+            goto state_133;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        default:
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        }
+    case 97:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(134, 77, value, tail);
+            goto state_134;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        default:
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        }
+    case 98:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(135, 77, value, tail);
+            goto state_135;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        default:
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        }
+    case 99:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 2:     /* '%' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 9:     /* '*' */
+        case 11:     /* '+' */
+        case 14:     /* ',' */
+        case 15:     /* '-' */
+        case 18:     /* '/' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(136, 67, value, tail);
+            goto state_136;
+        default:
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        }
+    case 100:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 2:     /* '%' */
+        case 6:     /* '&&' */
+        case 8:     /* ')' */
+        case 9:     /* '*' */
+        case 11:     /* '+' */
+        case 14:     /* ',' */
+        case 15:     /* '-' */
+        case 18:     /* '/' */
+        case 20:     /* ';' */
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 24:     /* '==' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+        case 28:     /* ']' */
+        case 38:     /* '||' */
+            PUSH(137, 67, value, tail);
+            goto state_137;
+        default:
+            PUSH(119, 84, value, tail);
+            goto state_119;
+        }
+    case 101:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(138, 52, value, tail);
+            goto state_138;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        }
+    case 103:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(140, 52, value, tail);
+            goto state_140;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        }
+    case 145:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 14:     /* ',' */
+        case 20:     /* ';' */
+        case 28:     /* ']' */
+            PUSH(148, 43, value, tail);
+            goto state_148;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        }
+    case 146:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        }
+    case 147:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        }
+    case 151:
+        switch (token.number) {
+        case 1:     /* '!=' */
+        case 24:     /* '==' */
+            PUSH(51, 51, value, tail);
+            goto state_51;
+        case 2:     /* '%' */
+        case 9:     /* '*' */
+        case 18:     /* '/' */
+            PUSH(45, 67, value, tail);
+            goto state_45;
+        case 6:     /* '&&' */
+            PUSH(47, 63, value, tail);
+            goto state_47;
+        case 8:     /* ')' */
+        case 28:     /* ']' */
+            PUSH(50, 52, value, tail);
+            goto state_50;
+        case 11:     /* '+' */
+        case 15:     /* '-' */
+            PUSH(54, 42, value, tail);
+            goto state_54;
+        case 14:     /* ',' */
+            PUSH(53, 43, value, tail);
+            goto state_53;
+        case 20:     /* ';' */
+            PUSH(44, 70, value, tail);
+            goto state_44;
+        case 21:     /* '<' */
+        case 22:     /* '<=' */
+        case 25:     /* '>' */
+        case 26:     /* '>=' */
+            PUSH(40, 77, value, tail);
+            goto state_40;
+        case 38:     /* '||' */
+            PUSH(46, 64, value, tail);
+            goto state_46;
+        default:
+            PUSH(36, 84, value, tail);
+            goto state_36;
+        }
+    default:
+        PUSH(36, 84, value, tail);
+        goto state_36;
+    }
+
+goto_85:         /* while_st */
+    switch (stateStack[sp]) {
+    case 25:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 32:     /* 'if' */
+        case 34:     /* 'return' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(37, 80, value, tail);
+            goto state_37;
+        case 31:     /* 'else' */
+            PUSH(38, 79, value, tail);
+            goto state_38;
+        default:
+            PUSH(35, 85, value, tail);
+            goto state_35;
+        }
+    case 37:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 34:     /* 'return' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(81, 79, value, tail);
+            goto state_81;
+        default:
+            PUSH(35, 85, value, tail);
+            goto state_35;
+        }
+    case 146:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 34:     /* 'return' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(149, 79, value, tail);
+            goto state_149;
+        default:
+            PUSH(35, 85, value, tail);
+            goto state_35;
+        }
+    case 147:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 34:     /* 'return' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(150, 79, value, tail);
+            goto state_150;
+        default:
+            PUSH(35, 85, value, tail);
+            goto state_35;
+        }
+    case 151:
+        switch (token.number) {
+        case 0:     /* '!' */
+        case 4:     /* 'ident' */
+        case 5:     /* '%number' */
+        case 7:     /* '(' */
+        case 12:     /* '++' */
+        case 15:     /* '-' */
+        case 16:     /* '--' */
+        case 20:     /* ';' */
+        case 31:     /* 'else' */
+        case 32:     /* 'if' */
+        case 34:     /* 'return' */
+        case 36:     /* 'while' */
+        case 37:     /* '{' */
+        case 39:     /* '}' */
+            PUSH(152, 79, value, tail);
+            goto state_152;
+        default:
+            PUSH(35, 85, value, tail);
+            goto state_35;
+        }
+    default:
+        PUSH(35, 85, value, tail);
+        goto state_35;
+    }
+
+accept:
+    c->sp = sp;
+    return valueStack[sp - 1];
+
+error:
+    c->sp = sp;
+    c->errcnt++;
+    if (quietErrors) return 0;
+    printf(" === error in source ===\n");
+    printf("Current Token : ");
+    printToken(token);
+    dumpStack();
+    if (!errorRecovery()) return 0;
+    sp = c->sp;
+    token = c->nextToken();
+    switch (stateStack[sp]) {
+    case 0: goto state_0;
+    case 1: goto state_1;
+    case 2: goto state_2;
+    case 3: goto state_3;
+    case 4: goto state_4;
+    case 5: goto state_5;
+    case 6: goto state_6;
+    case 7: goto state_7;
+    case 8: goto state_8;
+    case 9: goto state_9;
+    case 10: goto state_10;
+    case 11: goto state_11;
+    case 12: goto state_12;
+    case 13: goto state_13;
+    case 14: goto state_14;
+    case 15: goto state_15;
+    case 16: goto state_16;
+    case 17: goto state_17;
+    case 18: goto state_18;
+    case 19: goto state_19;
+    case 20: goto state_20;
+    case 21: goto state_21;
+    case 22: goto state_22;
+    case 23: goto state_23;
+    case 24: goto state_24;
+    case 25: goto state_25;
+    case 26: goto state_26;
+    case 27: goto state_27;
+    case 28: goto state_28;
+    case 29: goto state_29;
+    case 30: goto state_30;
+    case 31: goto state_31;
+    case 32: goto state_32;
+    case 33: goto state_33;
+    case 34: goto state_34;
+    case 35: goto state_35;
+    case 36: goto state_36;
+    case 37: goto state_37;
+    case 38: goto state_38;
+    case 39: goto state_39;
+    case 40: goto state_40;
+    case 41: goto state_41;
+    case 42: goto state_42;
+    case 43: goto state_43;
+    case 44: goto state_44;
+    case 45: goto state_45;
+    case 46: goto state_46;
+    case 47: goto state_47;
+    case 48: goto state_48;
+    case 49: goto state_49;
+    case 50: goto state_50;
+    case 51: goto state_51;
+    case 52: goto state_52;
+    case 53: goto state_53;
+    case 54: goto state_54;
+    case 55: goto state_55;
+    case 56: goto state_56;
+    case 57: goto state_57;
+    case 58: goto state_58;
+    case 59: goto state_59;
+    case 60: goto state_60;
+    case 61: goto state_61;
+    case 62: goto state_62;
+    case 63: goto state_63;
+    case 64: goto state_64;
+    case 65: goto state_65;
+    case 66: goto state_66;
+    case 67: goto state_67;
+    case 68: goto state_68;
+    case 69: goto state_69;
+    case 70: goto state_70;
+    case 71: goto state_71;
+    case 72: goto state_72;
+    case 73: goto state_73;
+    case 74: goto state_74;
+    case 75: goto state_75;
+    case 76: goto state_76;
+    case 77: goto state_77;
+    case 78: goto state_78;
+    case 79: goto state_79;
+    case 80: goto state_80;
+    case 81: goto state_81;
+    case 82: goto state_82;
+    case 83: goto state_83;
+    case 84: goto state_84;
+    case 85: goto state_85;
+    case 86: goto state_86;
+    case 87: goto state_87;
+    case 88: goto state_88;
+    case 89: goto state_89;
+    case 90: goto state_90;
+    case 91: goto state_91;
+    case 92: goto state_92;
+    case 93: goto state_93;
+    case 94: goto state_94;
+    case 95: goto state_95;
+    case 96: goto state_96;
+    case 97: goto state_97;
+    case 98: goto state_98;
+    case 99: goto state_99;
+    case 100: goto state_100;
+    case 101: goto state_101;
+    case 102: goto state_102;
+    case 103: goto state_103;
+    case 104: goto state_104;
+    case 105: goto state_105;
+    case 106: goto state_106;
+    case 107: goto state_107;
+    case 108: goto state_108;
+    case 109: goto state_109;
+    case 110: goto state_110;
+    case 111: goto state_111;
+    case 112: goto state_112;
+    case 113: goto state_113;
+    case 114: goto state_114;
+    case 115: goto state_115;
+    case 116: goto state_116;
+    case 117: goto state_117;
+    case 118: goto state_118;
+    case 119: goto state_119;
+    case 120: goto state_120;
+    case 121: goto state_121;
+    case 122: goto state_122;
+    case 123: goto state_123;
+    case 124: goto state_124;
+    case 125: goto state_125;
+    case 126: goto state_126;
+    case 127: goto state_127;
+    case 128: goto state_128;
+    case 129: goto state_129;
+    case 130: goto state_130;
+    case 131: goto state_131;
+    case 132: goto state_132;
+    case 133: goto state_133;
+    case 134: goto state_134;
+    case 135: goto state_135;
+    case 136: goto state_136;
+    case 137: goto state_137;
+    case 138: goto state_138;
+    case 139: goto state_139;
+    case 140: goto state_140;
+    case 141: goto state_141;
+    case 142: goto state_142;
+    case 143: goto state_143;
+    case 144: goto state_144;
+    case 145: goto state_145;
+    case 146: goto state_146;
+    case 147: goto state_147;
+    case 148: goto state_148;
+    case 149: goto state_149;
+    case 150: goto state_150;
+    case 151: goto state_151;
+    case 152: goto state_152;
+    }
+    goto error;
+} // directParser
@@ -1,61 +1,91 @@
+/*
+ * ICG - Mini C to Ucode compiler
+ *
+ *   cc -O2 -o icg ICG.c Parser.c Scanner.c DirectParser.c SplitParser.c \
+ *       -lpthread
+ *   cc -O2 -DDENSE_TABLE -o icg ICG.c Parser.c Scanner.c DirectParser.c \
+ *       SplitParser.c -lpthread
+ *
+ *   icg [options] file.mc|file.astb ...   (see main() for the options)
+ *
+ * the second line builds parser() with the dense parsing table in place
+ * of the packed one. DirectParser.c is generated and is written again by
+ * "directgen" (see DirectGen.c) when MiniC.gr or MiniC.tbl changes.
+ * on Windows the threads are not used and -lpthread is left out.
+ */
 #include "Parser.h"
+#include "Ucode.h"
+#include <limits.h>
+#ifndef _WIN32
+#include <pthread.h>
+#include <unistd.h>
+#endif
 
 #define LABEL_SIZE 10
-#define SYMTAB_SIZE 100
-
-FILE *sourceFile;
-FILE *ucodeFile;
-FILE *astFile;
-
-int base = 1, offset = 1, width = 1;
-int lvalue, rvalue;
-
-enum opcodeEnum {
-    notop,	neg,	incop,	decop,	dup,
-    add,	sub,	mult,	divop,	modop,	swp,
-    andop,	orop,	gt,	lt,	ge,	le,	eq,	ne,
-    lod,	str,	ldc,	lda,
-    ujp,	tjp,	fjp,
-    chkh,	chkl,
-    ldi,	sti,
-    call,	ret,	retv,	ldp,	proc,	endop,
-    nop,	bgn,	sym
-};
-
-char *opcodeName[] = {
-    "notop",    "neg",	"inc",	"dec",	"dup",
-    "add",	"sub",	"mult",	"div",	"mod",	"swp",
-    "and",	"or",	"gt",	"lt",	"ge",	"le",	"eq",	"ne",
-    "lod",	"str",	"ldc",	"lda",
-    "ujp",	"tjp",	"fjp",
-    "chkh",	"chkl",
-    "ldi",	"sti",
-    "call",	"ret",	"retv",	"ldp",	"proc",	"end",
-    "nop",	"bgn",	"sym"
-};
+#define CODE_SIZE 4096          // initial size of the code buffer
+#define SYMTAB_SIZE 100         // initial size of symbol table
+#define NAME_SIZE 256           // longest source file name
 
 enum typeEnum {
     INT_TYPE,	VOID_TYPE,	VAR_TYPE,	CONST_TYPE,	FUNC_TYPE
 };
 
 typedef struct tableType {
-    char name[LABEL_SIZE];
+    int name;           // interned identifier id
     int typeSpecifier;
     int typeQualifier;
     int base;
     int offset;
     int width;
-    int iniialValue;
+    int initialValue;
     int level;
+    int shadow;         // entry of the same name it hides, -1 if none
+    int definition;     // FUNC_DEF node of a function, 0 otherwise
 } SymbolTable;
 
-SymbolTable symbolTable[SYMTAB_SIZE];
-int symLevel = 0;
-int stTop;
-
+// the entries are kept in declaration order in symbolTable[0..stTop).
+// identifiers are interned, so visible[id] - 1 is the innermost entry
+// of a name(0: none) and lookup() is one array access. an entry hides
+// the one it was declared over until its scope is left.
 void initSymbolTable()
 {
-    stTop = 0;
+    cc->stTop = 0;
+    cc->symLevel = 0;
+    cc->noScopes = 0;
+    if(cc->visible) memset(cc->visible, 0, cc->visibleSize * sizeof(int));
+}
+
+void freeSymbolTable()
+{
+    free(cc->symbolTable);
+    free(cc->visible);
+    free(cc->scopes);
+}
+
+// a scope is the part of the table from its mark on
+void enterScope()
+{
+    if(cc->noScopes == cc->scopesSize) {
+        cc->scopesSize = cc->scopesSize ? 2 * cc->scopesSize : 16;
+        cc->scopes = (int*)realloc(cc->scopes, cc->scopesSize * sizeof(int));
+        if(!cc->scopes) {
+            printf("realloc error in enterScope()\n");
+            exit(1);
+        }
+    }
+    cc->scopes[cc->noScopes++] = cc->stTop;
+    cc->symLevel++;
+}
+
+void leaveScope()
+{
+    int mark = cc->scopes[--cc->noScopes];
+
+    while(cc->stTop > mark) {
+        cc->stTop--;
+        cc->visible[cc->symbolTable[cc->stTop].name] = cc->symbolTable[cc->stTop].shadow + 1;
+    }
+    cc->symLevel--;
 }
 
 void icg_error(int errno)
@@ -64,20 +94,44 @@ void icg_error(int errno)
 }
 
 //////////////////////////////////////////////////////////////////////////// Declaration
-int insert(char *name, int typeSpecifier, int typeQualifier,
+int insert(int name, int typeSpecifier, int typeQualifier,
         int base, int offset, int width, int initialValue)
 {
-    SymbolTable *stptr = &symbolTable[stTop];
-    strcpy(stptr->name, name);
+    SymbolTable *stptr;
+
+    if(cc->stTop == cc->stSize) {
+        cc->stSize = cc->stSize ? 2 * cc->stSize : SYMTAB_SIZE;
+        cc->symbolTable = (SymbolTable*)realloc(cc->symbolTable, cc->stSize * sizeof(SymbolTable));
+        if(!cc->symbolTable) {
+            printf("realloc error in insert()\n");
+            exit(1);
+        }
+    }
+    if(name >= cc->visibleSize) {
+        int size = cc->visibleSize ? cc->visibleSize : 1024;
+        while(size <= name) size *= 2;
+        cc->visible = (int*)realloc(cc->visible, size * sizeof(int));
+        if(!cc->visible) {
+            printf("realloc error in insert()\n");
+            exit(1);
+        }
+        memset(cc->visible + cc->visibleSize, 0, (size - cc->visibleSize) * sizeof(int));
+        cc->visibleSize = size;
+    }
+    stptr = &cc->symbolTable[cc->stTop];
+    stptr->shadow = cc->visible[name] - 1;
+    cc->visible[name] = cc->stTop + 1;
+    stptr->name = name;
     stptr->typeSpecifier = typeSpecifier;
     stptr->typeQualifier = typeQualifier;
     stptr->base = base;
     stptr->offset = offset;
     stptr->width = width;
     stptr->initialValue = initialValue;
-    stptr->level = symLevel;
+    stptr->level = cc->symLevel;
+    stptr->definition = 0;
 
-    return ++stTop;
+    return ++cc->stTop;
 }
 
 int typeSize(int typeSpecifier)
@@ -90,86 +144,86 @@ int typeSize(int typeSpecifier)
     }
 }
 
-void processSimpleVariable(Node *ptr, int typeSpecifier, int typeQualifier)
+void processSimpleVariable(int ptr, int typeSpecifier, int typeQualifier)
 {
-    Node *p = ptr->son;     // variable name(=> identifier)
-    Node *q = ptr->brother; // initial value part
-    int stIndex, size, initialValue;
+    int p = SON(ptr);     // variable name(=> identifier)
+    int q = BROTHER(ptr); // initial value part
+    int size, initialValue;
     int sign = 1;
 
-    if(ptr->token.number != SIMPLE_VAR) printf("error in SIMPLE_VAR\n");
+    if(KIND(ptr) != SIMPLE_VAR) printf("error in SIMPLE_VAR\n");
 
     if(typeQualifier == CONST_TYPE) {   // constant type
-        if(q == NULL) {
-            printf("%s must have a constant value\n", ptr->son->token.value.id);
+        if(!q) {
+            printf("%s must have a constant value\n", idName(VALUE(p)));
             return;
         }
-        if(q->token.number == UNARY_MINUS) {
+        if(KIND(q) == UNARY_MINUS) {
             sign = -1;
-            q = q->son;
+            q = SON(q);
         }
-        initialValue = sign * q->token.value.num;
+        initialValue = sign * VALUE(q);
 
-        stIndex = insert(p->token.value.id, typeSpecifier, typeQualifier,
+        insert(VALUE(p), typeSpecifier, typeQualifier,
                 0/*base*/, 0/*offset*/, 0/*width*/, initialValue);
     } else {
         size = typeSize(typeSpecifier);
-        stIndex = insert(p->token.value.id, typeSpecifier, typeQualifier,
-                base, offset, width, 0);
-        offset += size;
+        insert(VALUE(p), typeSpecifier, typeQualifier,
+                cc->base, cc->offset, cc->width, 0);
+        cc->offset += size;
     }
 }
 
-void processArrayVariable(Node *ptr, int typeSpecifier, int typeQualifier)
+void processArrayVariable(int ptr, int typeSpecifier, int typeQualifier)
 {
-    Node *p = ptr->son; // variable name(=> identifier)
-    int stIndex, size;
+    int p = SON(ptr); // variable name(=> identifier)
+    int size = 0;
 
-    if(ptr->token.number != ARRAY_VAR) {
+    if(KIND(ptr) != ARRAY_VAR) {
         printf("error in ARRAY_VAR\n");
         return;
     }
-    if(p->brother == NULL) // no size
+    if(!BROTHER(p)) // no size
         printf("array size must be specified\n");
-    else size = p->brother->token.value.num;
+    else size = VALUE(BROTHER(p));
 
     size *= typeSize(typeSpecifier);
 
-    stIndex = insert(p->token.value.id, typeSpecifier, typeQualifier,
-            base, offset, size, 0);
-    offset += size;
+    insert(VALUE(p), typeSpecifier, typeQualifier,
+            cc->base, cc->offset, size, 0);
+    cc->offset += size;
 }
 
-void processDeclaration(Node *ptr)
+void processDeclaration(int ptr)
 {
     int typeSpecifier, typeQualifier;
-    Node *p, *q;
+    int p, q;
 
-    if(ptr->token.number != DCL_SPEC) icg_error(4);
+    if(KIND(ptr) != DCL_SPEC) icg_error(4);
 
     // printf("processDeclaration\n");
     // step 1: process DCL_SPEC
     typeSpecifier = INT_TYPE; // default type
     typeQualifier = VAR_TYPE;
-    p = ptr->son;
+    p = SON(ptr);
     while(p) {
-        if(p->token.number == INT_NODE) typeSpecifier = INT_TYPE;
-        else if(p->token.number == CONST_NODE)
+        if(KIND(p) == INT_NODE) typeSpecifier = INT_TYPE;
+        else if(KIND(p) == CONST_NODE)
             typeQualifier = CONST_TYPE;
         else { // AUTO, EXTERN, REGISTER, FLOAT, DOUBLE, SIGNED, UNSIGEND
             printf("not yet implemented\n");
             return;
         }
-        p = p->brother;
+        p = BROTHER(p);
     }
 
     // step 2: process DCL_ITEM
-    p = ptr->brother;
-    if(p->token.number != DCL_ITEM) icg_error(5);
+    p = BROTHER(ptr);
+    if(KIND(p) != DCL_ITEM) icg_error(5);
 
     while(p) {
-        q = p->son; // SIMPLE_VAR or ARRAY_VAR
-        switch(q->token.number) {
+        q = SON(p); // SIMPLE_VAR or ARRAY_VAR
+        switch(KIND(q)) {
             case SIMPLE_VAR: // simple variable
                 processSimpleVariable(q, typeSpecifier, typeQualifier);
                 break;
@@ -180,126 +234,653 @@ void processDeclaration(Node *ptr)
                 printf("error in SIMPLE_VAR or ARRAY_VAR\n");
                 break;
         }
-        p = p->brother;
+        p = BROTHER(p);
     }
 }
 
-//////////////////////////////////////////////////////////////////////////// Expression
-int lookup(char *name)
+//////////////////////////////////////////////////////////////////////////// Code buffer
+// the code generator appends instructions to cc->code and the text
+// Ucode is written once, by writeCode(), when a compilation is done.
+// a label is a number, label n is written $$n.
+typedef struct instruction {
+    short opcode;
+    short noOperands;
+    int label;          // nop: label number, proc: function name id
+    int operand[3];     // ujp, tjp, fjp, jeq..jle: label number, call: function name id
+} Instruction;
+
+Instruction *emit(int opcode, int noOperands)
 {
-    int i;
-    for(i=0; i<stTop; i++) {
-        if((strcmp(name, symbolTable[i].name) == 0) && (symbolTable[i].level == symLevel)) {
-            return i;
+    Instruction *instr;
+
+    if(cc->codeCount == cc->codeSize) {
+        cc->codeSize = cc->codeSize ? 2 * cc->codeSize : CODE_SIZE;
+        cc->code = (Instruction*)realloc(cc->code, cc->codeSize * sizeof(Instruction));
+        if(!cc->code) {
+            printf("realloc error in emit()\n");
+            exit(1);
         }
     }
-    return -1;
+    instr = &cc->code[cc->codeCount++];
+    instr->opcode = opcode;
+    instr->noOperands = noOperands;
+    instr->label = 0;
+    return instr;
 }
 
 void emit0(int opcode)
 {
-    fprintf(ucodeFile, "           %s\n", opcodeName[opcode]);
+    emit(opcode, 0);
 }
 
 void emit1(int opcode, int operand)
 {
-    fprintf(ucodeFile, "           %s %d\n", opcodeName[opcode], operand);
+    emit(opcode, 1)->operand[0] = operand;
 }
 
 void emit2(int opcode, int operand1, int operand2)
 {
-    fprintf(ucodeFile, "           %s %d %d\n", opcodeName[opcode], operand1, operand2);
+    Instruction *instr = emit(opcode, 2);
+    instr->operand[0] = operand1;
+    instr->operand[1] = operand2;
 }
 
 void emit3(int opcode, int operand1, int operand2, int operand3)
 {
-    fprintf(ucodeFile, "           %s %d %d %d\n", opcodeName[opcode], operand1, operand2, operand3);
+    Instruction *instr = emit(opcode, 3);
+    instr->operand[0] = operand1;
+    instr->operand[1] = operand2;
+    instr->operand[2] = operand3;
+}
+
+void emitJump(int opcode, int label)
+{
+    emit(opcode, 1)->operand[0] = label;
+}
+
+void emitCall(int name)
+{
+    emit(call, 1)->operand[0] = name;
+}
+
+int genLabel()
+{
+    return cc->labelNum++;
+}
+
+void emitLabel(int label)
+{
+    emit(nop, 0)->label = label;
+}
+
+void emitFunc(int functionName, int operand1, int operand2, int operand3)
+{
+    Instruction *instr = emit(proc, 3);
+    instr->label = functionName;
+    instr->operand[0] = operand1;
+    instr->operand[1] = operand2;
+    instr->operand[2] = operand3;
+}
+
+// the text is formatted into outBuffer and written a block at a time
+#define OUT_BUFFER 65536
+
+static char *formatInt(char *p, int n)
+{
+    char digits[12];
+    unsigned int u = n < 0 ? -(unsigned int)n : (unsigned int)n;
+    int i = 0;
+
+    if(n < 0) *p++ = '-';
+    do {
+        digits[i++] = '0' + u % 10;
+        u /= 10;
+    } while(u);
+    while(i) *p++ = digits[--i];
+    return p;
+}
+
+// label field of LABEL_SIZE+1 columns, a longer label is not cut and
+// is followed by one blank
+static char *formatLabel(char *p, char *name, int number)
+{
+    char *start = p;
+
+    if(name) {
+        while(*name) *p++ = *name++;
+    } else {
+        *p++ = '$'; *p++ = '$';
+        p = formatInt(p, number);
+    }
+    do *p++ = ' '; while(p - start < LABEL_SIZE+1);
+    return p;
+}
+
+void writeCode(FILE *fp)
+{
+    char *outBuffer, *p, *name;
+    const char *q;
+    Instruction *instr, *end;
+    long size, need;
+    int i;
+
+    size = OUT_BUFFER;
+    outBuffer = (char*)malloc(size);
+    if(!outBuffer) {
+        printf("malloc error in writeCode()\n");
+        exit(1);
+    }
+    p = outBuffer;
+    end = cc->code + cc->codeCount;
+    for(instr = cc->code; instr < end; instr++) {
+        name = NULL;
+        if(instr->opcode == proc) name = idName(instr->label);
+        else if(instr->opcode == call) name = idName(instr->operand[0]);
+
+        // room for a label, a mnemonic, three numbers and the name
+        need = LABEL_SIZE + 64 + (name ? strlen(name) : 0);
+        if(p - outBuffer + need > size) {
+            fwrite(outBuffer, 1, p - outBuffer, fp);
+            p = outBuffer;
+            if(need > size) {
+                size = need;
+                free(outBuffer);
+                p = outBuffer = (char*)malloc(size);
+                if(!outBuffer) {
+                    printf("malloc error in writeCode()\n");
+                    exit(1);
+                }
+            }
+        }
+
+        if(instr->opcode == nop) p = formatLabel(p, NULL, instr->label);
+        else if(instr->opcode == proc) p = formatLabel(p, name, 0);
+        else p = formatLabel(p, "", 0);
+        for(q = opcodeName[instr->opcode]; *q; ) *p++ = *q++;
+
+        switch(instr->opcode) {
+            case ujp: case tjp: case fjp:
+            case jeq: case jne: case jgt: case jlt: case jge: case jle:
+                *p++ = ' '; *p++ = '$'; *p++ = '$';
+                p = formatInt(p, instr->operand[0]);
+                break;
+            case call:
+                *p++ = ' ';
+                while(*name) *p++ = *name++;
+                break;
+            default:
+                for(i = 0; i < instr->noOperands; i++) {
+                    *p++ = ' ';
+                    p = formatInt(p, instr->operand[i]);
+                }
+                break;
+        }
+        *p++ = '\n';
+    }
+    fwrite(outBuffer, 1, p - outBuffer, fp);
+    free(outBuffer);
+}
+
+//////////////////////////////////////////////////////////////////////////// Peephole
+// a rule rewrites two adjacent instructions a, b. match says what else
+// they must have: the constant of ldc a, equal operands(str x, lod x),
+// or a jumping to the label b. the rewritten instructions keep their
+// operands, none deletes one. a label is a nop, so no rule matches two
+// instructions that a jump can come between.
+enum matchEnum {
+    MATCH_ANY,  MATCH_VALUE,    MATCH_SAME, MATCH_TARGET
+};
+
+typedef struct peepholeRule {
+    const char *name;
+    int first, second;      // opcodes of a and b
+    int match, value;
+    int newFirst, newSecond;
+} PeepholeRule;
+
+static PeepholeRule peepholeRules[] = {
+    { "ldc 1, add => inc",      ldc,    add,    MATCH_VALUE,  1, none,   incop },
+    { "ldc 1, sub => dec",      ldc,    sub,    MATCH_VALUE,  1, none,   decop },
+    { "ldc 0, add => -",        ldc,    add,    MATCH_VALUE,  0, none,   none },
+    { "ldc 0, sub => -",        ldc,    sub,    MATCH_VALUE,  0, none,   none },
+    { "ldc 1, mult => -",       ldc,    mult,   MATCH_VALUE,  1, none,   none },
+    { "ldc 1, div => -",        ldc,    divop,  MATCH_VALUE,  1, none,   none },
+    { "neg, neg => -",          neg,    neg,    MATCH_ANY,    0, none,   none },
+    { "inc, dec => -",          incop,  decop,  MATCH_ANY,    0, none,   none },
+    { "dec, inc => -",          decop,  incop,  MATCH_ANY,    0, none,   none },
+    { "notop, fjp => tjp",      notop,  fjp,    MATCH_ANY,    0, none,   tjp },
+    { "notop, tjp => fjp",      notop,  tjp,    MATCH_ANY,    0, none,   fjp },
+    { "str x, lod x => dup, str x", str, lod,   MATCH_SAME,   0, dupop,  str },
+    { "ujp L, L: => L:",        ujp,    nop,    MATCH_TARGET, 0, none,   nop },
+};
+
+#define NO_PEEPHOLE_RULES (int)(sizeof(peepholeRules) / sizeof(PeepholeRule))
+
+int optimize;                   // -O: optimize the generated code
+
+static int ruleMatches(PeepholeRule *rule, Instruction *a, Instruction *b)
+{
+    if(a->opcode != rule->first || b->opcode != rule->second) return 0;
+    switch(rule->match) {
+        case MATCH_VALUE:
+            return a->operand[0] == rule->value;
+        case MATCH_SAME:
+            return a->operand[0] == b->operand[0] && a->operand[1] == b->operand[1];
+        case MATCH_TARGET:
+            return a->operand[0] == b->label;
+    }
+    return 1;
+}
+
+static void rewrite(Instruction *instr, int opcode)
+{
+    if(instr->opcode == opcode) return;
+    instr->opcode = opcode;
+    instr->noOperands = opcodeOperands[opcode];
+}
+
+// rewrites the code of the function that starts at code[start] and
+// reports the rules that fired. the code is compacted in place: each
+// instruction is appended to the kept ones and the rules are tried on
+// the last two until none matches, so a rewrite can enable another.
+void peephole(int start)
+{
+    int fired[NO_PEEPHOLE_RULES];
+    Instruction *code = cc->code, *a, *b;
+    int i, j, r, total;
+
+    memset(fired, 0, sizeof(fired));
+    total = 0;
+    for(i = j = start; i < cc->codeCount; i++) {
+        code[j++] = code[i];
+        r = 0;
+        while(j - start >= 2 && r < NO_PEEPHOLE_RULES) {
+            if(!ruleMatches(&peepholeRules[r], &code[j-2], &code[j-1])) {
+                r++;
+                continue;
+            }
+            fired[r]++;
+            total++;
+            a = &code[j-2];
+            b = &code[j-1];
+            rewrite(a, peepholeRules[r].newFirst);
+            rewrite(b, peepholeRules[r].newSecond);
+            if(b->opcode == none) j--;
+            if(a->opcode == none) {
+                if(b->opcode != none) *a = *b;
+                j--;
+            }
+            r = 0;
+        }
+    }
+    cc->codeCount = j;
+
+    if(!total) return;
+    printf("   * peephole %s: %d rewrites", idName(code[start].label), total);
+    for(r = 0; r < NO_PEEPHOLE_RULES; r++)
+        if(fired[r]) printf(", %s: %d", peepholeRules[r].name, fired[r]);
+    printf("\n");
+}
+
+//////////////////////////////////////////////////////////////////////////// Dead code
+// with -O the code of a function loses, after the peephole pass:
+//   - the instructions no path from proc reaches, the jumps to the
+//     next instruction and the labels no jump refers to
+//   - the stores to locals that no lod or lda reads, together with the
+//     code of the stored value when it has no effect(no call, store,
+//     jump, label or division), repeated while some go
+//   - the locals that are referenced no more: the others move down in
+//     the frame, proc gets the smaller frame size and the sym of a
+//     removed local goes.
+// the locals are the operands of base proc.value2, the parameters are
+// the first noParams words of the frame and stay.
+
+// drops code[i], start <= i < cc->codeCount, if keep[i - start] is 0.
+// returns the number dropped
+static int compactCode(int start, char *keep)
+{
+    int i, j;
+
+    for(i = j = start; i < cc->codeCount; i++)
+        if(keep[i - start]) cc->code[j++] = cc->code[i];
+    i = cc->codeCount - j;
+    cc->codeCount = j;
+    return i;
+}
+
+// code[k] pushes the value that the next instruction stores. returns
+// the first instruction of the code that computes it, -1 if that code
+// has an effect or reorders the stack(swp)
+static int valueStart(int start, int k)
+{
+    int need = 1;           // values still to be pushed
+
+    for(; k > start; k--) {
+        switch(cc->code[k].opcode) {
+            case lod: case ldc: case lda: case dupop:
+                need--;
+                break;
+            case notop: case neg: case incop: case decop: case ldi:
+                break;
+            case add: case sub: case mult: case andop: case orop:
+            case gt: case lt: case ge: case le: case eq: case ne:
+                need++;
+                break;
+            default:
+                return -1;
+        }
+        if(!need) return k;
+    }
+    return -1;
+}
+
+static int isJump(int opcode)
+{
+    return opcode == ujp || opcode == tjp || opcode == fjp || (opcode >= jeq && opcode <= jle);
+}
+
+static int isLocal(Instruction *instr, int base, int frameSize)
+{
+    return (instr->opcode == lod || instr->opcode == lda || instr->opcode == str
+            || instr->opcode == sym)
+        && instr->operand[0] == base && instr->operand[1] <= frameSize;
+}
+
+// code[start] is the proc of the function, its code ends at cc->codeCount
+void removeDeadCode(int start, int noParams)
+{
+    Instruction *code, *instr;
+    int base = cc->code[start].operand[1], frameSize = cc->code[start].operand[0];
+    int *labelIndex, *stack, *words, *newOffset;
+    char *keep, *read;
+    int lowLabel, highLabel, sp, i, k, changed, next;
+    int removedCode, removedLocals, removedWords;
+
+    code = cc->code;
+    lowLabel = cc->labelNum;
+    highLabel = 0;
+    for(i = start; i < cc->codeCount; i++)
+        if(code[i].opcode == nop) {
+            if(code[i].label < lowLabel) lowLabel = code[i].label;
+            if(code[i].label > highLabel) highLabel = code[i].label;
+        }
+    if(highLabel < lowLabel) lowLabel = highLabel;
+    labelIndex = (int*)malloc((highLabel - lowLabel + 1) * sizeof(int));
+    stack = (int*)malloc((cc->codeCount - start) * sizeof(int));
+    keep = (char*)calloc(cc->codeCount - start, 1);
+    read = (char*)calloc(frameSize + 1, 1);
+    words = (int*)malloc((frameSize + 1) * sizeof(int));
+    newOffset = (int*)malloc((frameSize + 1) * sizeof(int));
+    if(!labelIndex || !stack || !keep || !read || !words || !newOffset) {
+        printf("malloc error in removeDeadCode()\n");
+        exit(1);
+    }
+    for(i = start; i < cc->codeCount; i++)
+        if(code[i].opcode == nop) labelIndex[code[i].label - lowLabel] = i;
+
+    // step 1: the instructions reached from proc and the end of the
+    // function, without the jumps to the next instruction. a label stays
+    // if a jump that stays refers to it
+    sp = 0;
+    stack[sp++] = start;
+    keep[0] = 1;
+    while(sp) {
+        i = stack[--sp];
+        instr = &code[i];
+        switch(instr->opcode) {
+            case ujp: case tjp: case fjp:
+            case jeq: case jne: case jgt: case jlt: case jge: case jle:
+                k = labelIndex[instr->operand[0] - lowLabel];
+                if(!keep[k - start]) stack[sp++] = k;
+                keep[k - start] = 1;
+                if(instr->opcode == ujp) continue;
+                break;
+            case ret: case retv: case endop:
+                continue;
+        }
+        if(i + 1 < cc->codeCount && !keep[i + 1 - start]) {
+            keep[i + 1 - start] = 1;
+            stack[sp++] = i + 1;
+        }
+    }
+    keep[cc->codeCount - 1 - start] = 1;
+    for(i = start; i < cc->codeCount; i++) {
+        if(code[i].opcode != ujp || !keep[i - start]) continue;
+        for(k = i + 1; !keep[k - start]; k++);
+        if(code[k].opcode == nop && code[k].label == code[i].operand[0]) keep[i - start] = 0;
+    }
+    for(i = start; i < cc->codeCount; i++)
+        if(code[i].opcode == nop) keep[i - start] = 0;
+    for(i = start; i < cc->codeCount; i++)
+        if(keep[i - start] && isJump(code[i].opcode))
+            keep[labelIndex[code[i].operand[0] - lowLabel] - start] = 1;
+    removedCode = compactCode(start, keep);
+
+    // step 2: stores that are never read
+    do {
+        changed = 0;
+        memset(read, 0, frameSize + 1);
+        memset(keep, 1, cc->codeCount - start);
+        for(i = start; i < cc->codeCount; i++)
+            if((code[i].opcode == lod || code[i].opcode == lda) && isLocal(&code[i], base, frameSize))
+                read[code[i].operand[1]] = 1;
+        for(i = start; i < cc->codeCount; i++) {
+            if(code[i].opcode != str || !isLocal(&code[i], base, frameSize)
+                    || read[code[i].operand[1]] || (k = valueStart(start, i - 1)) < 0)
+                continue;
+            memset(keep + k - start, 0, i - k + 1);
+            changed = 1;
+        }
+        removedCode += compactCode(start, keep);
+    } while(changed);
+
+    // step 3: the frame without the locals referenced no more. a local
+    // has the words of its sym, a temporary of strength reduction one
+    for(i = 1; i <= frameSize; i++) words[i] = 1;
+    memset(read, 0, frameSize + 1);
+    for(i = start; i < cc->codeCount; i++) {
+        if(!isLocal(&code[i], base, frameSize)) continue;
+        if(code[i].opcode == sym) {
+            if(code[i].operand[2] > 1) words[code[i].operand[1]] = code[i].operand[2];
+        }
+        else read[code[i].operand[1]] = 1;
+    }
+    removedLocals = removedWords = 0;
+    for(i = next = 1; i <= frameSize; i += words[i]) {
+        newOffset[i] = 0;
+        if(i <= noParams || read[i]) {
+            newOffset[i] = next;
+            next += words[i];
+        } else {
+            removedLocals++;
+            removedWords += words[i];
+        }
+    }
+    if(removedLocals) {
+        memset(keep, 1, cc->codeCount - start);
+        for(i = start; i < cc->codeCount; i++) {
+            if(!isLocal(&code[i], base, frameSize)) continue;
+            if(!newOffset[code[i].operand[1]]) keep[i - start] = 0;   // sym
+            else code[i].operand[1] = newOffset[code[i].operand[1]];
+        }
+        code[start].operand[0] = next - 1;
+        removedCode += compactCode(start, keep);
+    }
+
+    free(labelIndex);
+    free(stack);
+    free(keep);
+    free(read);
+    free(words);
+    free(newOffset);
+    if(!removedCode && !removedLocals) return;
+    printf("   * dead code %s: %d instructions, %d locals(%d words) removed\n",
+            idName(code[start].label), removedCode, removedLocals, removedWords);
+}
+
+int lookup(int name);
+
+// the binary object file of ucodei(see Ucode.h): the labels and the
+// calls are resolved here, the address of an instruction is its index
+// in cc->code plus one.
+int writeObject(FILE *fp)
+{
+    UcodeHeader h;
+    UcodeInstruction *object;
+    Instruction *instr;
+    int *labelAddress, *procAddress;
+    int i, n, stIndex;
+
+    object = (UcodeInstruction*)calloc(cc->codeCount + 1, sizeof(UcodeInstruction));
+    labelAddress = (int*)calloc(cc->labelNum + 1, sizeof(int));
+    procAddress = (int*)calloc(cc->stTop + 1, sizeof(int));
+    if(!object || !labelAddress || !procAddress) {
+        printf("calloc error in writeObject()\n");
+        exit(1);
+    }
+
+    // step 1: addresses of the labels and the functions
+    h.startAddress = 0;
+    for(i = 0; i < cc->codeCount; i++) {
+        instr = &cc->code[i];
+        if(instr->opcode == nop) labelAddress[instr->label] = i + 1;
+        else if(instr->opcode == proc && (stIndex = lookup(instr->label)) >= 0)
+            procAddress[stIndex] = i + 1;
+        else if(instr->opcode == bgn) h.startAddress = i + 1;
+    }
+
+    // step 2: the instructions with their targets
+    for(i = 0; i < cc->codeCount; i++) {
+        instr = &cc->code[i];
+        object[i + 1].opcode = instr->opcode;
+        switch(instr->opcode) {
+            case ujp: case tjp: case fjp:
+            case jeq: case jne: case jgt: case jlt: case jge: case jle:
+                object[i + 1].value1 = labelAddress[instr->operand[0]];
+                break;
+            case call:
+                n = instr->operand[0];
+                if(n == ID_READ) object[i + 1].value1 = READPROC;
+                else if(n == ID_WRITE) object[i + 1].value1 = WRITEPROC;
+                else if(n == ID_LF) object[i + 1].value1 = LFPROC;
+                else if((stIndex = lookup(n)) >= 0) object[i + 1].value1 = procAddress[stIndex];
+                break;
+            default:
+                // as many operands as ucodei reads from the text
+                n = opcodeOperands[instr->opcode];
+                if(n > 0) object[i + 1].value1 = instr->operand[0];
+                if(n > 1) object[i + 1].value2 = instr->operand[1];
+                if(n > 2) object[i + 1].value3 = instr->operand[2];
+                break;
+        }
+    }
+
+    h.magic = UCODE_MAGIC;
+    h.version = UCODE_VERSION;
+    h.noInstructions = cc->codeCount;
+    n = fwrite(&h, sizeof(h), 1, fp) == 1
+        && fwrite(object, sizeof(UcodeInstruction), cc->codeCount + 1, fp) == (size_t)cc->codeCount + 1;
+    free(object);
+    free(labelAddress);
+    free(procAddress);
+    return n;
 }
 
-void emitJump(int opcode, char *label)
+//////////////////////////////////////////////////////////////////////////// Expression
+// innermost entry of name, locals before globals. -1 if undeclared
+int lookup(int name)
 {
-    fprintf(ucodeFile, "           %s %s\n", opcodeName[opcode], label);
+    if(name >= cc->visibleSize) return -1;
+    return cc->visible[name] - 1;
 }
 
-void rv_emit(Node *ptr)
+void rv_emit(int ptr)
 {
     int stIndex;
 
-    if(ptr->token.number == tnumber)        // number
-        emit1(ldc, ptr->token.value.num);
+    if(KIND(ptr) == tnumber)        // number
+        emit1(ldc, VALUE(ptr));
     else {                                  // identifier
-        stIndex = lookup(ptr->token.value.id);
+        stIndex = lookup(VALUE(ptr));
         if(stIndex == -1) return;
-        if(symbolTable[stIndex].typeQualifier == CONST_TYPE) // constant
-            emit1(ldc, symbolTable[stIndex].initialValue);
-        else if(symbolTable[stIndex].width > 1)     // array var
-            emit2(lda, symbolTable[stIndex].base, symbolTable[stIndex].offset);
+        if(cc->symbolTable[stIndex].typeQualifier == CONST_TYPE) // constant
+            emit1(ldc, cc->symbolTable[stIndex].initialValue);
+        else if(cc->symbolTable[stIndex].width > 1)     // array var
+            emit2(lda, cc->symbolTable[stIndex].base, cc->symbolTable[stIndex].offset);
         else                                        // simple var
-            emit2(lod, symbolTable[stIndex].base, symbolTable[stIndex].offset);
+            emit2(lod, cc->symbolTable[stIndex].base, cc->symbolTable[stIndex].offset);
     }
 }
 
-void processOperator(Node *ptr);
-int checkPredefined(Node *ptr)
+void processOperator(int ptr);
+void processCondition(int ptr, int label, int value);
+int reducedAddress(int ptr);
+void reduceLoop(int ptr);
+void stepReductions(int ptr);
+int inlineCall(int ptr, int stIndex);
+void processParamDeclaration(int ptr);
+int commonAddress(int ptr, int *offset);
+void findCommonAddresses(int ptr);
+int checkPredefined(int ptr)
 {
-    Node *p = NULL;
-    if(strcmp(ptr->token.value.id, "read") == 0) {
+    int p = 0;
+    if(VALUE(ptr) == ID_READ) {
         emit0(ldp);
-        p = ptr->brother; // ACTUAL_PARAM
+        p = BROTHER(ptr); // ACTUAL_PARAM
         while(p) {
-            if(p->noderep == nonterm) processOperator(p);
+            if(NODEREP(p) == nonterm) processOperator(p);
             else rv_emit(p);
-            p = p->brother;
+            p = BROTHER(p);
         }
-        emitJump(call, "read");
+        emitCall(ID_READ);
         return 1;
     }
-    else if(strcmp(ptr->token.value.id, "write") == 0) {
+    else if(VALUE(ptr) == ID_WRITE) {
         emit0(ldp);
-        p = ptr->brother; // ACTUAL_PARAM
+        p = BROTHER(ptr); // ACTUAL_PARAM
         while(p) {
-            if(p->noderep == nonterm) processOperator(p);
+            if(NODEREP(p) == nonterm) processOperator(p);
             else rv_emit(p);
-            p = p->brother;
+            p = BROTHER(p);
         }
-        emitJump(call, "write");
+        emitCall(ID_WRITE);
         return 1;
     }
-    else if(strcmp(ptr->token.value.id, "lf") == 0) {
-        emitJump(call, "lf");
+    else if(VALUE(ptr) == ID_LF) {
+        emitCall(ID_LF);
         return 1;
     }
     return 0;
 }
 
-void processOperator(Node *ptr)
+void processOperator(int ptr)
 {
-    switch(ptr->token.number) {
+    switch(KIND(ptr)) {
         // assignment operator
         case ASSIGN_OP:
         {
-            Node *lhs = ptr->son, *rhs = ptr->son->brother;
+            int lhs = SON(ptr), rhs = BROTHER(SON(ptr));
             int stIndex;
 
             // step 1: generate instructions for left-hand side if INDEX node.
-            if(lhs->noderep == nonterm) { // array variable
-                lvalue = 1;
+            if(NODEREP(lhs) == nonterm) { // array variable
+                cc->lvalue = 1;
                 processOperator(lhs);
-                lvalue = 0;
+                cc->lvalue = 0;
             }
 
             // step 2: generate instructions for right-hand side
-            if(rhs->noderep == nonterm) processOperator(rhs);
+            if(NODEREP(rhs) == nonterm) processOperator(rhs);
             else rv_emit(rhs);
 
             // step 3: generate a store instruction
-            if(lhs->noderep == terminal) { // simple variable
-                stIndex = lookup(lhs->token.value.id);
+            if(NODEREP(lhs) == terminal) { // simple variable
+                stIndex = lookup(VALUE(lhs));
                 if(stIndex == -1) {
-                    printf("undefined variable : %s\n", lhs->token.value.id);
+                    printf("undefined variable : %s\n", idName(VALUE(lhs)));
                     return;
                 }
-                emit2(str, symbolTable[stIndex].base, symbolTable[stIndex].offset);
+                emit2(str, cc->symbolTable[stIndex].base, cc->symbolTable[stIndex].offset);
             } else
                 emit0(sti);
             break;
@@ -309,28 +890,31 @@ void processOperator(Node *ptr)
         case ADD_ASSIGN: case SUB_ASSIGN: case MUL_ASSIGN:
         case DIV_ASSIGN: case MOD_ASSIGN:
         {
-            Node *lhs = ptr->son, *rhs = ptr->son->brother;
-            int nodeNumber = ptr->token.number;
+            int lhs = SON(ptr), rhs = BROTHER(SON(ptr));
+            int nodeNumber = KIND(ptr);
             int stIndex;
 
-            ptr->token.number = ASSIGN_OP;
+            KIND(ptr) = ASSIGN_OP;
             // step 1: code generation for left hand side
-            if(lhs->noderep == nonterm) {
-                lvalue = 1;
+            if(NODEREP(lhs) == nonterm) {
+                cc->lvalue = 1;
                 processOperator(lhs);
-                lvalue = 0;
+                cc->lvalue = 0;
+            }
+            KIND(ptr) = nodeNumber;
+            // step 2: code generation for repeating part, an element is
+            // loaded through its address
+            if(NODEREP(lhs) == nonterm) {
+                emit0(dupop);
+                emit0(ldi);
             }
-            ptr->token.number = nodeNumber;
-            // step 2: code generation for repeating part
-            if(lhs->noderep == nonterm)
-                processOperator(lhs);
             else rv_emit(lhs);
             // step 3: code generation for right hand side
-            if(rhs->noderep == nonterm)
+            if(NODEREP(rhs) == nonterm)
                 processOperator(rhs);
             else rv_emit(rhs);
             // step 4: emit the corresponding operation code
-            switch(ptr->token.number) {
+            switch(KIND(ptr)) {
                 case ADD_ASSIGN: emit0(add); break;
                 case SUB_ASSIGN: emit0(sub); break;
                 case MUL_ASSIGN: emit0(mult); break;
@@ -338,33 +922,47 @@ void processOperator(Node *ptr)
                 case MOD_ASSIGN: emit0(modop); break;
             }
             // step 5: code generation for store code
-            if(lhs->noderep == terminal) {
-                stIndex = lookup(lhs->token.value.id);
+            if(NODEREP(lhs) == terminal) {
+                stIndex = lookup(VALUE(lhs));
                 if(stIndex == -1) {
-                    printf("undefined variable : %s\n", lhs->son->token.value.id);
+                    printf("undefined variable : %s\n", idName(VALUE(lhs)));
                     return;
                 }
-                emit2(str, symbolTable[stIndex].base, symbolTable[stIndex].offset);
+                emit2(str, cc->symbolTable[stIndex].base, cc->symbolTable[stIndex].offset);
             } else
                 emit0(sti);
             break;
         }
 
-        // binary(arithmetic/relational/logical) operators
+        // logical operators: the right operand is evaluated only when it
+        // decides the value, which is 0 or 1
+        case LOGICAL_AND: case LOGICAL_OR:
+        {
+            int falseLabel = genLabel(), endLabel = genLabel();
+
+            processCondition(ptr, falseLabel, 0);
+            emit1(ldc, 1);
+            emitJump(ujp, endLabel);
+            emitLabel(falseLabel);
+            emit1(ldc, 0);
+            emitLabel(endLabel);
+            break;
+        }
+
+        // binary(arithmetic/relational) operators
         case ADD: case SUB: case MUL: case DIV: case MOD:
         case EQ: case NE: case GT: case LT: case GE: case LE:
-        case LOGICAL_AND: case LOGICAL_OR:
         {
-            Node *lhs = ptr->son, *rhs = ptr->son->brother;
+            int lhs = SON(ptr), rhs = BROTHER(SON(ptr));
 
             // step 1: visit left operand
-            if(lhs->noderep == nonterm) processOperator(lhs);
+            if(NODEREP(lhs) == nonterm) processOperator(lhs);
             else rv_emit(lhs);
             // step 2: visit right operand
-            if(rhs->noderep == nonterm) processOperator(rhs);
+            if(NODEREP(rhs) == nonterm) processOperator(rhs);
             else rv_emit(rhs);
             // step 3: visit root
-            switch(ptr->token.number) {
+            switch(KIND(ptr)) {
                 case ADD: emit0(add); break;            // arithmetic operators
                 case SUB: emit0(sub); break;
                 case MUL: emit0(mult); break;
@@ -376,8 +974,6 @@ void processOperator(Node *ptr)
                 case LT: emit0(lt); break;
                 case GE: emit0(ge); break;
                 case LE: emit0(le); break;
-                case LOGICAL_AND: emit0(andop); break;  // logical operators
-                case LOGICAL_OR: emit0(orop); break;
             }
             break;
         }
@@ -385,11 +981,11 @@ void processOperator(Node *ptr)
         // unary operators
         case UNARY_MINUS: case LOGICAL_NOT:
         {
-            Node *p = ptr->son;
+            int p = SON(ptr);
 
-            if(p->noderep == nonterm) processOperator(p);
+            if(NODEREP(p) == nonterm) processOperator(p);
             else rv_emit(p);
-            switch(ptr->token.number) {
+            switch(KIND(ptr)) {
                 case UNARY_MINUS: emit0(neg); break;
                 case LOGICAL_NOT: emit0(notop); break;
             }
@@ -399,190 +995,255 @@ void processOperator(Node *ptr)
         // increment/decrement operators
         case PRE_INC: case PRE_DEC: case POST_INC: case POST_DEC:
         {
-            Node *p = ptr->son; Node *q;
+            int p = SON(ptr); int q;
             int stIndex; // int amount = 1;
-            if(p->noderep == nonterm) processOperator(p); // compute operand
+            if(NODEREP(p) == nonterm) {     // compute operand, keep its address
+                cc->lvalue = 1;
+                processOperator(p);
+                cc->lvalue = 0;
+                emit0(dupop);
+                emit0(ldi);
+            }
             else rv_emit(p);
 
             q = p;
-            while(q->noderep != terminal) q = q->son;
-            if(!q || (q->token.number != tident)) {
+            while(NODEREP(q) != terminal) q = SON(q);
+            if(!q || (KIND(q) != tident)) {
                 printf("increment/decrement operators can not be applied in expression\n");
                 return;
             }
-            stIndex = lookup(q->token.value.id);
+            stIndex = lookup(VALUE(q));
             if(stIndex == -1) return;
 
-            switch(ptr->token.number) {
+            switch(KIND(ptr)) {
                 case PRE_INC:
                     emit0(incop);
-                    // if(isOperation(ptr)) emit0(dup);
+                    // if(isOperation(ptr)) emit0(dupop);
                     break;
                 case PRE_DEC:
                     emit0(decop);
-                    // if(isOperation(ptr)) emit0(dup);
+                    // if(isOperation(ptr)) emit0(dupop);
                     break;
                 case POST_INC:
-                    // if(isOperation(ptr)) emit0(dup);
+                    // if(isOperation(ptr)) emit0(dupop);
                     emit0(incop);
                     break;
                 case POST_DEC:
-                    // if(isOperation(ptr)) emit0(dup);
+                    // if(isOperation(ptr)) emit0(dupop);
                     emit0(decop);
                     break;
             }
-            if(p->noderep == terminal) {
-                stIndex = lookup(p->token.value.id);
+            if(NODEREP(p) == terminal) {
+                stIndex = lookup(VALUE(p));
                 if(stIndex == -1) return;
-                emit2(str, symbolTable[stIndex].base, symbolTable[stIndex].offset);
-            } else if(p->token.number == INDEX) { // compute index
-                lvalue = 1;
-                processOperator(p);
-                lvalue = 0;
-                emit0(swp);
+                emit2(str, cc->symbolTable[stIndex].base, cc->symbolTable[stIndex].offset);
+            } else if(KIND(p) == INDEX)     // address is below the value
                 emit0(sti);
-            }
             else printf("error in increment/decrement operators\n");
             break;
         }
 
         case INDEX:
         {
-            Node *indexExp = ptr->son->brother;
-            int stIndex;
+            int indexExp = BROTHER(SON(ptr));
+            int stIndex, offset, lvalue = cc->lvalue, common = 0;
 
-            if(indexExp->noderep == nonterm) processOperator(indexExp);
+            if(cc->noReductions && (offset = reducedAddress(ptr))) {
+                emit2(lod, cc->base, offset);   // address temporary
+                if(!cc->lvalue) emit0(ldi);
+                break;
+            }
+            if(cc->noAddresses && (common = commonAddress(ptr, &offset)) == 2) {
+                emit2(lod, cc->base, offset);   // address computed before
+                if(!cc->lvalue) emit0(ldi);
+                break;
+            }
+            cc->lvalue = 0;                     // the index is a value
+            if(NODEREP(indexExp) == nonterm) processOperator(indexExp);
             else rv_emit(indexExp);
-            stIndex = lookup(ptr->son->token.value.id);
+            cc->lvalue = lvalue;
+            stIndex = lookup(VALUE(SON(ptr)));
             if(stIndex == -1) {
-                printf("undefined variable: %s\n", ptr->son->token.value.id);
+                printf("undefined variable: %s\n", idName(VALUE(SON(ptr))));
                 return;
             }
-            emit2(lda, symbolTable[stIndex].base, symbolTable[stIndex].offset);
+            emit2(lda, cc->symbolTable[stIndex].base, cc->symbolTable[stIndex].offset);
             emit0(add);
-            if(!lvalue) emit0(ldi); // rvalue
+            if(common == 1) {                   // kept for the later uses
+                emit0(dupop);
+                emit2(str, cc->base, offset);
+            }
+            if(!cc->lvalue) emit0(ldi); // rvalue
             break;
         }
 
         case CALL:
         {
-            Node *p = ptr->son;     // function name
-            char *functionName;
+            int p = SON(ptr);     // function name
+            int functionName;
             int stIndex; int noArguments;
             if(checkPredefined(p))  // predefined(Library) functions
                 break;
 
             // handle for user function
-            functionName = p->token.value.id;
+            functionName = VALUE(p);
             stIndex = lookup(functionName);
             if(stIndex == -1) break; // undefined function !!!
-            noArguments = symbolTable[stIndex].width;
+            if(optimize && inlineCall(ptr, stIndex)) break;
+            noArguments = cc->symbolTable[stIndex].width;
 
             emit0(ldp);
-            p = p->brother;     // ACTUAL_PARAM
+            p = BROTHER(p);     // ACTUAL_PARAM
             while(p) {          // processing actual arguemtns
-                if(p->noderep == nonterm) processOperator(p);
+                if(NODEREP(p) == nonterm) processOperator(p);
                 else rv_emit(p);
                 noArguments--;
-                p = p->brother;
+                p = BROTHER(p);
             }
             if(noArguments > 0)
-                printf("%s: too few actual arguments", functionName);
+                printf("%s: too few actual arguments", idName(functionName));
             if(noArguments < 0)
-                printf("%s: too many actual arguments", functionName);
-            emitJump(call, ptr->son->token.value.id);
+                printf("%s: too many actual arguments", idName(functionName));
+            emitCall(functionName);
             break;
         }
     } // end switch
 }
 
 //////////////////////////////////////////////////////////////////////////// Statement
-void genLabel(char *label)
-{
-    static int labelNum = 0;
-    sprintf(label, "$$%d", labelNum++);
-}
-
-void emitLabel(char *label)
+// jumping code: jumps to label when the truth value of the condition
+// is value and falls through otherwise. && and || jump as soon as their
+// left operand decides, ! swaps the sense of the jump and a comparison
+// is one compare and branch instruction(jeq..jle).
+void processCondition(int ptr, int label, int value)
 {
-    int length;
-    length = strlen(label);
-    fprintf(ucodeFile, "%s", label);
-    for(; length < LABEL_SIZE+1; length++)
-        fprintf(ucodeFile, " ");
-    fprintf(ucodeFile, "nop\n");
-}
+    int skip;
 
-void processCondition(Node *ptr)
-{
-    if(ptr->noderep == nonterm) processOperator(ptr);
-    else rv_emit(ptr);
+    if(NODEREP(ptr) == terminal) {
+        rv_emit(ptr);
+        emitJump(value ? tjp : fjp, label);
+        return;
+    }
+    switch(KIND(ptr)) {
+        case LOGICAL_AND: case LOGICAL_OR:
+            // the left operand jumps to label itself if it decides the
+            // value sought, or past the right operand if it decides the other
+            if((KIND(ptr) == LOGICAL_AND) == !value) {
+                processCondition(SON(ptr), label, value);
+                processCondition(BROTHER(SON(ptr)), label, value);
+            } else {
+                skip = genLabel();
+                processCondition(SON(ptr), skip, !value);
+                processCondition(BROTHER(SON(ptr)), label, value);
+                emitLabel(skip);
+            }
+            break;
+        case LOGICAL_NOT:
+            processCondition(SON(ptr), label, !value);
+            break;
+        case EQ: case NE: case GT: case LT: case GE: case LE:
+            // compare and branch, with the opposite comparison for a
+            // jump on false
+            if(NODEREP(SON(ptr)) == nonterm) processOperator(SON(ptr));
+            else rv_emit(SON(ptr));
+            if(NODEREP(BROTHER(SON(ptr))) == nonterm) processOperator(BROTHER(SON(ptr)));
+            else rv_emit(BROTHER(SON(ptr)));
+            switch(KIND(ptr)) {
+                case EQ: emitJump(value ? jeq : jne, label); break;
+                case NE: emitJump(value ? jne : jeq, label); break;
+                case GT: emitJump(value ? jgt : jle, label); break;
+                case LT: emitJump(value ? jlt : jge, label); break;
+                case GE: emitJump(value ? jge : jlt, label); break;
+                case LE: emitJump(value ? jle : jgt, label); break;
+            }
+            break;
+        default:
+            processOperator(ptr);
+            emitJump(value ? tjp : fjp, label);
+            break;
+    }
 }
 
-void processStatement(Node *ptr)
+void processStatement(int ptr)
 {
-    Node *p;
-    int returnWithValue;
+    int p;
 
-    switch(ptr->token.number) {
+    switch(KIND(ptr)) {
         case COMPOUND_ST:
-            p = ptr->son->brother; // STAT_LIST
-            p = p->son;
+        {
+            int noAddresses = cc->noAddresses, offset = cc->offset;
+            int block = 0;      // in a run of expression statements
+
+            p = BROTHER(SON(ptr)); // STAT_LIST
+            p = SON(p);
             while(p) {
+                if(KIND(p) != EXP_ST) {         // end of a block
+                    cc->noAddresses = noAddresses;
+                    cc->offset = offset;
+                    block = 0;
+                }
+                else if(optimize && !block) {
+                    findCommonAddresses(p);
+                    block = 1;
+                }
                 processStatement(p);
-                p = p->brother;
+                p = BROTHER(p);
             }
+            cc->noAddresses = noAddresses;
+            cc->offset = offset;
             break;
+        }
         case EXP_ST:
-            if(ptr->son != NULL) processOperator(ptr->son);
+            if(SON(ptr)) processOperator(SON(ptr));
+            if(cc->noReductions) stepReductions(ptr);
             break;
         case RETURN_ST:
-            if(ptr->son != NULL) {
-                returnWithValue = 1;
-                p = ptr->son;
-                if(p->noderep == nonterm)
+            if(SON(ptr)) {
+                p = SON(ptr);
+                if(NODEREP(p) == nonterm)
                     processOperator(p); // return value
                 else rv_emit(p);
-                emit0(retv);
-            } else 
+                if(cc->inlining) emitJump(ujp, cc->returnLabel);
+                else emit0(retv);
+            } else if(cc->inlining)
+                emitJump(ujp, cc->returnLabel);
+            else
                 emit0(ret);
             break;
         case IF_ST:
         {
-            char label[LABEL_SIZE];
+            int label = genLabel();
 
-            genLabel(label);
-            processCondition(ptr->son);             // condition part
-            emitJump(fjp, label);
-            processStatement(ptr->son->brother);    // true part
+            processCondition(SON(ptr), label, 0);   // condition part
+            processStatement(BROTHER(SON(ptr)));    // true part
             emitLabel(label);
         }
         break;
         case IF_ELSE_ST:
         {
-            char label1[LABEL_SIZE], label2[LABEL_SIZE];
+            int label1 = genLabel(), label2 = genLabel();
 
-            genLabel(label1); genLabel(label2);
-            processCondition(ptr->son);             // condition part
-            emitJump(fjp, label1);
-            processStatement(ptr->son->brother);    // true part
+            processCondition(SON(ptr), label1, 0);  // condition part
+            processStatement(BROTHER(SON(ptr)));    // true part
             emitJump(ujp, label2);
             emitLabel(label1);
-            processStatement(ptr->son->brother->brother); // false part
+            processStatement(BROTHER(BROTHER(SON(ptr)))); // false part
             emitLabel(label2);
         }
         break;
         case WHILE_ST:
         {
-            char label1[LABEL_SIZE], label2[LABEL_SIZE];
+            int label1 = genLabel(), label2 = genLabel();
+            int noReductions = cc->noReductions, offset = cc->offset;
 
-            genLabel(label1); genLabel(label2);
+            if(optimize) reduceLoop(ptr);
             emitLabel(label1);
-            processCondition(ptr->son);             // condition part
-            emitJump(fjp, label2);
-            processStatement(ptr->son->brother);    // loop body
+            processCondition(SON(ptr), label2, 0);  // condition part
+            processStatement(BROTHER(SON(ptr)));    // loop body
             emitJump(ujp, label1);
             emitLabel(label2);
+            cc->noReductions = noReductions;
+            cc->offset = offset;
         }
         break;
         default:
@@ -591,62 +1252,793 @@ void processStatement(Node *ptr)
     } // end switch
 }
 
+//////////////////////////////////////////////////////////////////////////// Constant folding
+// with -O the body of a function is folded before code is generated for
+// it: an operator whose operands are numbers or const variables becomes
+// a number node, and an if or a while with a constant condition keeps
+// only the statement that runs. a local that is assigned once, from a
+// constant, by a statement of the function body(not one nested in an
+// if or a while) and not used before it is replaced by the constant in
+// the statements after it.
+
+// value of a number or a const variable
+static int constantValue(int ptr, int *value)
+{
+    int stIndex;
+
+    if(NODEREP(ptr) != terminal) return 0;
+    if(KIND(ptr) == tnumber) {
+        *value = VALUE(ptr);
+        return 1;
+    }
+    stIndex = lookup(VALUE(ptr));
+    if(stIndex == -1 || cc->symbolTable[stIndex].typeQualifier != CONST_TYPE) return 0;
+    *value = cc->symbolTable[stIndex].initialValue;
+    return 1;
+}
+
+static void makeNumber(int ptr, int value)
+{
+    KIND(ptr) = tnumber;
+    VALUE(ptr) = value;
+    NODEREP(ptr) = terminal;
+    SON(ptr) = 0;
+}
+
+// the statement ptr becomes the statement p, or an empty one if p is 0
+static void replaceStatement(int ptr, int p)
+{
+    int brother = BROTHER(ptr);
+
+    if(p) cc->nodes[ptr] = cc->nodes[p];
+    else {
+        KIND(ptr) = EXP_ST;
+        NODEREP(ptr) = nonterm;
+        SON(ptr) = 0;
+    }
+    BROTHER(ptr) = brother;
+}
+
+// computes the operator like the generated code does. returns 0 if it
+// is not folded
+static int foldOperator(int kind, int a, int b, int *value)
+{
+    switch(kind) {
+        case ADD: *value = (int)((unsigned int)a + (unsigned int)b); break;
+        case SUB: *value = (int)((unsigned int)a - (unsigned int)b); break;
+        case MUL: *value = (int)((unsigned int)a * (unsigned int)b); break;
+        case DIV: case MOD:
+            if(!b || (b == -1 && a == INT_MIN)) return 0;   // left to run time
+            *value = kind == DIV ? a / b : a % b;
+            break;
+        case EQ: *value = a == b; break;
+        case NE: *value = a != b; break;
+        case GT: *value = a > b; break;
+        case LT: *value = a < b; break;
+        case GE: *value = a >= b; break;
+        case LE: *value = a <= b; break;
+        case LOGICAL_AND: *value = a && b; break;
+        case LOGICAL_OR: *value = a || b; break;
+        case UNARY_MINUS: *value = (int)-(unsigned int)a; break;
+        case LOGICAL_NOT: *value = !a; break;
+        default: return 0;
+    }
+    return 1;
+}
+
+void foldExpression(int ptr)
+{
+    int p, a, b, value;
+
+    if(NODEREP(ptr) == terminal) return;
+    for(p = SON(ptr); p; p = BROTHER(p)) foldExpression(p);
+
+    p = SON(ptr);
+    switch(KIND(ptr)) {
+        case UNARY_MINUS: case LOGICAL_NOT:
+            if(constantValue(p, &a) && foldOperator(KIND(ptr), a, 0, &value))
+                makeNumber(ptr, value);
+            break;
+        case LOGICAL_AND: case LOGICAL_OR:
+            // a constant left operand that decides skips the right one
+            if(constantValue(p, &a) && !a == (KIND(ptr) == LOGICAL_AND)) {
+                makeNumber(ptr, !!a);
+                break;
+            }
+            if(constantValue(p, &a) && constantValue(BROTHER(p), &b)
+                    && foldOperator(KIND(ptr), a, b, &value))
+                makeNumber(ptr, value);
+            break;
+        default:
+            if(p && BROTHER(p) && constantValue(p, &a) && constantValue(BROTHER(p), &b)
+                    && foldOperator(KIND(ptr), a, b, &value))
+                makeNumber(ptr, value);
+            break;
+    }
+}
+
+void foldStatement(int ptr)
+{
+    int p, value;
+
+    switch(KIND(ptr)) {
+        case COMPOUND_ST:
+            for(p = SON(BROTHER(SON(ptr))); p; p = BROTHER(p)) foldStatement(p);
+            break;
+        case EXP_ST: case RETURN_ST:
+            if(SON(ptr)) foldExpression(SON(ptr));
+            break;
+        case IF_ST:
+            p = SON(ptr);
+            foldExpression(p);
+            foldStatement(BROTHER(p));
+            if(constantValue(p, &value)) replaceStatement(ptr, value ? BROTHER(p) : 0);
+            break;
+        case IF_ELSE_ST:
+            p = SON(ptr);
+            foldExpression(p);
+            foldStatement(BROTHER(p));
+            foldStatement(BROTHER(BROTHER(p)));
+            if(constantValue(p, &value))
+                replaceStatement(ptr, value ? BROTHER(p) : BROTHER(BROTHER(p)));
+            break;
+        case WHILE_ST:
+            p = SON(ptr);
+            foldExpression(p);
+            foldStatement(BROTHER(p));
+            if(constantValue(p, &value) && !value) replaceStatement(ptr, 0);
+            break;
+    }
+}
+
+// the passes below keep an element for each entry of the function
+// scope in their arrays, at the local index of the entry
+static int localIndex(int stIndex)
+{
+    int first = cc->scopes[cc->noScopes - 1];
+
+    return stIndex >= first ? stIndex - first : -1;
+}
+
+static int noLocals()
+{
+    return cc->stTop - cc->scopes[cc->noScopes - 1];
+}
+
+// writes[local]: 1 for each assignment to the variable, 2 for each
+// other write or use as an array, so only 1 leaves it a candidate
+static void countWrites(int ptr, int *writes)
+{
+    int p, stIndex;
+
+    if(NODEREP(ptr) == terminal || KIND(ptr) == DCL_LIST) return;
+    p = SON(ptr);
+    switch(KIND(ptr)) {
+        case ASSIGN_OP:
+        case ADD_ASSIGN: case SUB_ASSIGN: case MUL_ASSIGN: case DIV_ASSIGN: case MOD_ASSIGN:
+        case PRE_INC: case PRE_DEC: case POST_INC: case POST_DEC:
+        case INDEX:
+            if(NODEREP(p) == terminal && (stIndex = localIndex(lookup(VALUE(p)))) >= 0)
+                writes[stIndex] += KIND(ptr) == ASSIGN_OP ? 1 : 2;
+            break;
+        case CALL:
+            if(VALUE(p) != ID_READ) break;
+            for(p = BROTHER(p); p; p = BROTHER(p))
+                if(NODEREP(p) == terminal && KIND(p) == tident
+                        && (stIndex = localIndex(lookup(VALUE(p)))) >= 0)
+                    writes[stIndex] += 2;
+            p = SON(ptr);
+            break;
+    }
+    for(; p; p = BROTHER(p)) countWrites(p, writes);
+}
+
+// replaces the variables of known[] by their values, or marks them used
+static void substitute(int ptr, int *known, int *value, int *used)
+{
+    int stIndex;
+
+    if(NODEREP(ptr) == terminal) {
+        if(KIND(ptr) != tident || (stIndex = localIndex(lookup(VALUE(ptr)))) < 0) return;
+        if(known[stIndex]) makeNumber(ptr, value[stIndex]);
+        else if(used) used[stIndex] = 1;
+        return;
+    }
+    if(KIND(ptr) == DCL_LIST) return;
+    for(ptr = SON(ptr); ptr; ptr = BROTHER(ptr))
+        substitute(ptr, known, value, used);
+}
+
+// body: COMPOUND_ST of the function
+void foldFunction(int body)
+{
+    int *writes, *known, *value, *used;
+    int s, lhs, rhs, stIndex, n;
+
+    n = noLocals() + 1;
+    writes = (int*)calloc(4 * n, sizeof(int));
+    if(!writes) {
+        printf("calloc error in foldFunction()\n");
+        exit(1);
+    }
+    known = writes + n;
+    value = known + n;
+    used = value + n;
+    countWrites(body, writes);
+
+    for(s = SON(BROTHER(SON(body))); s; s = BROTHER(s)) {
+        substitute(s, known, value, NULL);
+        foldStatement(s);
+        stIndex = -1;
+        if(KIND(s) == EXP_ST && SON(s) && KIND(SON(s)) == ASSIGN_OP) {
+            lhs = SON(SON(s));
+            rhs = BROTHER(lhs);
+            if(NODEREP(lhs) == terminal && NODEREP(rhs) == terminal && KIND(rhs) == tnumber
+                    && (stIndex = localIndex(lookup(VALUE(lhs)))) >= 0
+                    && (writes[stIndex] != 1 || used[stIndex]))
+                stIndex = -1;
+        }
+        substitute(s, known, value, used);
+        if(stIndex >= 0) {
+            known[stIndex] = 1;
+            value[stIndex] = VALUE(rhs);
+        }
+    }
+    free(writes);
+}
+
+//////////////////////////////////////////////////////////////////////////// Strength reduction
+// with -O a while loop whose body steps a local i by a constant in a
+// statement of its own(i++, i += c, i = i + c, ...) that is the only
+// write of i in the loop keeps the address of an array element a[e],
+// e linear in i, in a temporary: it is set to a + e before the loop and
+// stepped by the change of e right after the step of i, so the element
+// is one lod in place of the code of e, lda a and add. the rest of e
+// may use numbers, const variables and locals the loop does not write.
+// the temporaries take frame slots above the locals, the proc
+// instruction gets the frame size when the function is done.
+typedef struct reduction {
+    int array;          // symbol table entry of a
+    int index;          // e
+    int update;         // statement that steps i
+    int step;           // of e per step of i
+    int offset;         // of the temporary in the frame
+} Reduction;
+
+// the step of i if the statement steps a local i by a constant
+static int stepStatement(int ptr, int *stIndex, int *step)
+{
+    int p, lhs, a, b;
+
+    if(KIND(ptr) != EXP_ST || !(p = SON(ptr)) || NODEREP(p) != nonterm) return 0;
+    lhs = SON(p);
+    if(NODEREP(lhs) != terminal || KIND(lhs) != tident) return 0;
+    switch(KIND(p)) {
+        case PRE_INC: case POST_INC: *step = 1; break;
+        case PRE_DEC: case POST_DEC: *step = -1; break;
+        case ADD_ASSIGN: case SUB_ASSIGN:
+            if(!constantValue(BROTHER(lhs), step)) return 0;
+            if(KIND(p) == SUB_ASSIGN) *step = -*step;
+            break;
+        case ASSIGN_OP:                         // i = i + c, i = c + i, i = i - c
+            p = BROTHER(lhs);
+            if(NODEREP(p) != nonterm || (KIND(p) != ADD && KIND(p) != SUB)) return 0;
+            a = SON(p);
+            b = BROTHER(a);
+            if(NODEREP(a) == terminal && KIND(a) == tident && VALUE(a) == VALUE(lhs)
+                    && constantValue(b, step)) {
+                if(KIND(p) == SUB) *step = -*step;
+            }
+            else if(KIND(p) != ADD || NODEREP(b) != terminal || KIND(b) != tident
+                    || VALUE(b) != VALUE(lhs) || !constantValue(a, step))
+                return 0;
+            break;
+        default:
+            return 0;
+    }
+    *stIndex = lookup(VALUE(lhs));
+    return *step && *stIndex >= 0 && cc->symbolTable[*stIndex].base == cc->base
+        && cc->symbolTable[*stIndex].typeQualifier != CONST_TYPE
+        && cc->symbolTable[*stIndex].width <= 1;
+}
+
+// the coefficient of i in e if e is linear in i and the rest is
+// invariant in the loop, whose writes are in writes[local]
+static int linearIn(int ptr, int stIndex, int *writes, int *coef)
+{
+    int a, b, c, st;
+
+    if(NODEREP(ptr) == terminal) {
+        *coef = 0;
+        if(KIND(ptr) == tnumber) return 1;
+        if((st = lookup(VALUE(ptr))) < 0) return 0;
+        if(st == stIndex) *coef = 1;
+        else if(cc->symbolTable[st].typeQualifier != CONST_TYPE
+                && (cc->symbolTable[st].base != cc->base || writes[localIndex(st)]
+                    || cc->symbolTable[st].width > 1))
+            return 0;
+        return 1;
+    }
+    switch(KIND(ptr)) {
+        case ADD: case SUB:
+            if(!linearIn(SON(ptr), stIndex, writes, &a)
+                    || !linearIn(BROTHER(SON(ptr)), stIndex, writes, &b))
+                return 0;
+            *coef = KIND(ptr) == ADD ? a + b : a - b;
+            return 1;
+        case MUL:
+            if(!linearIn(SON(ptr), stIndex, writes, &a)
+                    || !linearIn(BROTHER(SON(ptr)), stIndex, writes, &b)
+                    || (a && b))
+                return 0;
+            if(a && !constantValue(BROTHER(SON(ptr)), &c)) return 0;
+            if(b && !constantValue(SON(ptr), &c)) return 0;
+            *coef = a ? a * c : b ? b * c : 0;
+            return 1;
+        case UNARY_MINUS:
+            if(!linearIn(SON(ptr), stIndex, writes, &a)) return 0;
+            *coef = -a;
+            return 1;
+    }
+    return 0;
+}
+
+static int sameTree(int p, int q)
+{
+    if(KIND(p) != KIND(q) || VALUE(p) != VALUE(q) || NODEREP(p) != NODEREP(q)) return 0;
+    if(NODEREP(p) == terminal) return 1;
+    for(p = SON(p), q = SON(q); p && q; p = BROTHER(p), q = BROTHER(q))
+        if(!sameTree(p, q)) return 0;
+    return !p && !q;
+}
+
+// the temporary of the element ptr(INDEX), 0 if it has none
+int reducedAddress(int ptr)
+{
+    Reduction *r;
+    int array = lookup(VALUE(SON(ptr)));
+
+    for(r = cc->reductions + cc->noReductions; r-- > cc->reductions; )
+        if(r->array == array && sameTree(r->index, BROTHER(SON(ptr)))) return r->offset;
+    return 0;
+}
+
+// adds a temporary for each element of the loop subtree ptr that is
+// linear in i and sets it before the loop
+static void findElements(int ptr, int stIndex, int step, int update, int *writes)
+{
+    Reduction *r;
+    int p, array, coef;
+
+    if(NODEREP(ptr) == terminal || KIND(ptr) == DCL_LIST) return;
+    for(p = SON(ptr); p; p = BROTHER(p)) findElements(p, stIndex, step, update, writes);
+    if(KIND(ptr) != INDEX || reducedAddress(ptr)) return;
+    array = lookup(VALUE(SON(ptr)));
+    if(array < 0 || cc->symbolTable[array].width <= 1
+            || !linearIn(BROTHER(SON(ptr)), stIndex, writes, &coef) || !coef)
+        return;
+
+    if(cc->noReductions == cc->reductionsSize) {
+        cc->reductionsSize = cc->reductionsSize ? 2 * cc->reductionsSize : 16;
+        cc->reductions = (Reduction*)realloc(cc->reductions, cc->reductionsSize * sizeof(Reduction));
+        if(!cc->reductions) {
+            printf("realloc error in findElements()\n");
+            exit(1);
+        }
+    }
+    r = &cc->reductions[cc->noReductions++];
+    r->array = array;
+    r->index = BROTHER(SON(ptr));
+    r->update = update;
+    r->step = (int)((unsigned int)coef * (unsigned int)step);
+    r->offset = cc->offset++;
+    if(cc->offset > cc->frameTop) cc->frameTop = cc->offset;
+
+    // temporary = a + e, in the order of the INDEX code
+    if(NODEREP(r->index) == nonterm) processOperator(r->index);
+    else rv_emit(r->index);
+    emit2(lda, cc->symbolTable[array].base, cc->symbolTable[array].offset);
+    emit0(add);
+    emit2(str, cc->base, r->offset);
+}
+
+// called before the code of the while loop ptr. the caller drops the
+// temporaries and their frame slots after the loop
+void reduceLoop(int ptr)
+{
+    int body = BROTHER(SON(ptr));
+    int *writes, *stepWrites;
+    int s, stIndex, step, n;
+
+    n = noLocals() + 1;
+    writes = (int*)calloc(2 * n, sizeof(int));
+    if(!writes) {
+        printf("calloc error in reduceLoop()\n");
+        exit(1);
+    }
+    stepWrites = writes + n;
+    countWrites(ptr, writes);
+
+    s = KIND(body) == COMPOUND_ST ? SON(BROTHER(SON(body))) : body;
+    for(; s; s = KIND(body) == COMPOUND_ST ? BROTHER(s) : 0) {
+        if(!stepStatement(s, &stIndex, &step)) continue;
+        memset(stepWrites, 0, n * sizeof(int));
+        countWrites(s, stepWrites);
+        if(writes[localIndex(stIndex)] == stepWrites[localIndex(stIndex)])
+            findElements(ptr, stIndex, step, s, writes);
+    }
+    free(writes);
+}
+
+// steps the temporaries of the statement ptr, after its code
+void stepReductions(int ptr)
+{
+    Reduction *r;
+
+    for(r = cc->reductions; r < cc->reductions + cc->noReductions; r++) {
+        if(r->update != ptr) continue;
+        emit2(lod, cc->base, r->offset);
+        if(r->step == 1) emit0(incop);
+        else if(r->step == -1) emit0(decop);
+        else {
+            emit1(ldc, r->step);
+            emit0(add);
+        }
+        emit2(str, cc->base, r->offset);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////// Common addresses
+// with -O an element a[e] that occurs again in the same run of
+// expression statements, with no write of a variable of e and no call in
+// between, has its address computed once: the first occurrence keeps it
+// in a temporary(dup, str) and the later ones load it. e is an operator
+// on numbers and simple variables. an element on the right of && or ||
+// may be skipped, so it only loads the address. the temporaries take
+// frame slots above the locals until the end of the run.
+typedef struct address {
+    int node;           // INDEX
+    int first;          // 1 if it keeps the address, 0 if it loads it
+    int offset;         // of the temporary in the frame
+} Address;
+
+// an element or a write of a run, in the order of their code
+typedef struct {
+    int node;           // INDEX, 0 for a write
+    int write;          // symbol table entry written, -1 for a call
+    int conditional;    // on the right of && or ||
+    int common;         // in a group of equal elements
+} AddressEvent;
+
+typedef struct {
+    AddressEvent *events;
+    int noEvents, eventsSize;
+} AddressEvents;
+
+static void addEvent(AddressEvents *list, int node, int write, int conditional)
+{
+    AddressEvent *e;
+
+    if(list->noEvents == list->eventsSize) {
+        list->eventsSize = list->eventsSize ? 2 * list->eventsSize : 64;
+        list->events = (AddressEvent*)realloc(list->events, list->eventsSize * sizeof(AddressEvent));
+        if(!list->events) {
+            printf("realloc error in addEvent()\n");
+            exit(1);
+        }
+    }
+    e = &list->events[list->noEvents++];
+    e->node = node;
+    e->write = write;
+    e->conditional = conditional;
+    e->common = 0;
+}
+
+// the events of the expression ptr, in the order of processOperator()
+static void scanAddresses(int ptr, AddressEvents *list, int conditional)
+{
+    int p;
+
+    if(NODEREP(ptr) == terminal) return;
+    switch(KIND(ptr)) {
+        case LOGICAL_AND: case LOGICAL_OR:
+            scanAddresses(SON(ptr), list, conditional);
+            scanAddresses(BROTHER(SON(ptr)), list, 1);
+            return;
+        case CALL:
+            for(p = BROTHER(SON(ptr)); p; p = BROTHER(p)) scanAddresses(p, list, conditional);
+            addEvent(list, 0, -1, conditional);
+            return;
+        case INDEX:
+            scanAddresses(BROTHER(SON(ptr)), list, conditional);
+            addEvent(list, ptr, 0, conditional);
+            return;
+    }
+    for(p = SON(ptr); p; p = BROTHER(p)) scanAddresses(p, list, conditional);
+    switch(KIND(ptr)) {
+        case ASSIGN_OP:
+        case ADD_ASSIGN: case SUB_ASSIGN: case MUL_ASSIGN: case DIV_ASSIGN: case MOD_ASSIGN:
+        case PRE_INC: case PRE_DEC: case POST_INC: case POST_DEC:
+            p = SON(ptr);
+            if(NODEREP(p) == terminal) addEvent(list, 0, lookup(VALUE(p)), conditional);
+            break;
+    }
+}
+
+// 1 if the index ptr has no side effect and reads no element
+static int pureIndex(int ptr)
+{
+    int p;
+
+    if(NODEREP(ptr) == terminal) {
+        if(KIND(ptr) == tnumber) return 1;
+        p = lookup(VALUE(ptr));
+        return p >= 0 && cc->symbolTable[p].width <= 1;
+    }
+    switch(KIND(ptr)) {
+        case ADD: case SUB: case MUL: case DIV: case MOD: case UNARY_MINUS:
+            for(p = SON(ptr); p; p = BROTHER(p))
+                if(!pureIndex(p)) return 0;
+            return 1;
+    }
+    return 0;
+}
+
+static int usesVariable(int ptr, int stIndex)
+{
+    int p;
+
+    if(NODEREP(ptr) == terminal) return KIND(ptr) == tident && lookup(VALUE(ptr)) == stIndex;
+    for(p = SON(ptr); p; p = BROTHER(p))
+        if(usesVariable(p, stIndex)) return 1;
+    return 0;
+}
+
+static void addAddress(int node, int first, int offset)
+{
+    Address *a;
+
+    if(cc->noAddresses == cc->addressesSize) {
+        cc->addressesSize = cc->addressesSize ? 2 * cc->addressesSize : 16;
+        cc->addresses = (Address*)realloc(cc->addresses, cc->addressesSize * sizeof(Address));
+        if(!cc->addresses) {
+            printf("realloc error in addAddress()\n");
+            exit(1);
+        }
+    }
+    a = &cc->addresses[cc->noAddresses++];
+    a->node = node;
+    a->first = first;
+    a->offset = offset;
+}
+
+// called before the code of the run of expression statements that
+// starts with ptr. the caller drops the temporaries after the run
+void findCommonAddresses(int ptr)
+{
+    AddressEvents list = { NULL, 0, 0 };
+    AddressEvent *e, *f;
+    int index, offset;
+
+    for(; ptr && KIND(ptr) == EXP_ST; ptr = BROTHER(ptr))
+        if(SON(ptr)) scanAddresses(SON(ptr), &list, 0);
+
+    for(e = list.events; e < list.events + list.noEvents; e++) {
+        if(!e->node || e->conditional || e->common) continue;
+        index = BROTHER(SON(e->node));
+        if(NODEREP(index) == terminal || !pureIndex(index)
+                || (cc->noReductions && reducedAddress(e->node)))
+            continue;
+        offset = 0;
+        for(f = e + 1; f < list.events + list.noEvents; f++) {
+            if(!f->node) {
+                if(f->write < 0 || usesVariable(index, f->write)) break;
+                continue;
+            }
+            if(f->common || VALUE(SON(f->node)) != VALUE(SON(e->node))
+                    || !sameTree(index, BROTHER(SON(f->node))))
+                continue;
+            if(!offset) {
+                offset = cc->offset++;
+                if(cc->offset > cc->frameTop) cc->frameTop = cc->offset;
+                addAddress(e->node, 1, offset);
+            }
+            addAddress(f->node, 0, offset);
+            f->common = 1;
+        }
+    }
+    free(list.events);
+}
+
+// 1 if the element ptr keeps its address in the temporary *offset, 2 if
+// it loads it from there, 0 if it has none
+int commonAddress(int ptr, int *offset)
+{
+    Address *a;
+
+    for(a = cc->addresses + cc->noAddresses; a-- > cc->addresses; )
+        if(a->node == ptr) {
+            *offset = a->offset;
+            return a->first ? 1 : 2;
+        }
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////// Inlining
+// with -O the call of a small leaf function is replaced by its body.
+// the arguments are evaluated in the scope of the caller and stored into
+// frame slots of the caller that stand for the parameters, the locals
+// of the callee take slots after them, and a return jumps to the end of
+// the body with its value on the stack. the function may call read,
+// write and lf but no user function, so it is not recursive, and it has
+// no arrays(the address temporaries of the caller's loops match array
+// elements by name). an identifier of the body that it does not declare
+// must not be hidden by a local of the caller.
+#define INLINE_NODES 48         // largest body inlined, in nodes
+
+// first PARAM_DCL of the function def
+static int formalParams(int def)
+{
+    return SON(BROTHER(BROTHER(SON(SON(def)))));    // FORMAL_PARA
+}
+
+// 1 if the name is declared by the list of PARAM_DCL or DCL ptr
+static int declaredIn(int ptr, int name)
+{
+    int p;
+
+    for(; ptr; ptr = BROTHER(ptr))
+        for(p = BROTHER(SON(ptr)); p; p = BROTHER(p)) {
+            if(KIND(ptr) == DCL) {
+                if(KIND(p) == DCL_ITEM && VALUE(SON(SON(p))) == name) return 1;
+            }
+            else if(VALUE(SON(p)) == name) return 1;
+        }
+    return 0;
+}
+
+// checks the subtree ptr of the body of the function def and counts its
+// nodes into *size. returns 0 if the body may not be inlined
+static int checkInline(int ptr, int def, int valueReturn, int *size)
+{
+    int p;
+
+    if(++*size > INLINE_NODES) return 0;
+    if(NODEREP(ptr) == terminal) {
+        if(KIND(ptr) != tident) return 1;
+        p = BROTHER(SON(def));                  // COMPOUND_ST
+        if(declaredIn(formalParams(def), VALUE(ptr)) || declaredIn(SON(SON(p)), VALUE(ptr)))
+            return 1;
+        return lookup(VALUE(ptr)) < cc->scopes[cc->noScopes - 1];  // a global
+    }
+    switch(KIND(ptr)) {
+        case INDEX: case ARRAY_VAR:
+            return 0;
+        case CALL:
+            p = VALUE(SON(ptr));
+            if(p != ID_READ && p != ID_WRITE && p != ID_LF) return 0;
+            break;
+        case RETURN_ST:
+            if((SON(ptr) != 0) != valueReturn) return 0;
+            break;
+    }
+    for(p = SON(ptr); p; p = BROTHER(p))
+        if(!checkInline(p, def, valueReturn, size)) return 0;
+    return 1;
+}
+
+// generates the call ptr of the function stIndex inline if it may be.
+// returns 0 if it is not inlined
+int inlineCall(int ptr, int stIndex)
+{
+    int def = cc->symbolTable[stIndex].definition;
+    int valueReturn = cc->symbolTable[stIndex].typeSpecifier != VOID_TYPE;
+    int body, p, size, noArguments, first, offset, endLabel;
+
+    if(!def || cc->inlining) return 0;
+    body = BROTHER(SON(def));                   // COMPOUND_ST
+    for(noArguments = 0, p = BROTHER(SON(ptr)); p; p = BROTHER(p)) noArguments++;
+    if(noArguments != cc->symbolTable[stIndex].width) return 0;
+
+    // the parameters, the locals and the statements
+    size = 0;
+    for(p = formalParams(def); p; p = BROTHER(p))
+        if(!checkInline(p, def, valueReturn, &size)) return 0;
+    for(p = SON(SON(body)); p; p = BROTHER(p))
+        if(!checkInline(p, def, valueReturn, &size)) return 0;
+    if(!checkInline(BROTHER(SON(body)), def, valueReturn, &size)) return 0;
+    if(valueReturn) {                           // the body ends with return e
+        for(p = SON(BROTHER(SON(body))); p && BROTHER(p); p = BROTHER(p));
+        if(!p || KIND(p) != RETURN_ST) return 0;
+    }
+
+    // step 1: the arguments, in the scope of the caller
+    for(p = BROTHER(SON(ptr)); p; p = BROTHER(p)) {
+        if(NODEREP(p) == nonterm) processOperator(p);
+        else rv_emit(p);
+    }
+
+    // step 2: the parameters and the locals of the callee in the frame
+    // of the caller, the last argument is on top of the stack
+    offset = cc->offset;
+    enterScope();
+    first = cc->stTop;
+    for(p = formalParams(def); p; p = BROTHER(p))
+        if(KIND(p) == PARAM_DCL) processParamDeclaration(SON(p));
+    for(p = SON(SON(body)); p; p = BROTHER(p))
+        if(KIND(p) == DCL) processDeclaration(SON(p));
+    if(cc->offset > cc->frameTop) cc->frameTop = cc->offset;
+    for(p = first + noArguments; p-- > first; )
+        emit2(str, cc->symbolTable[p].base, cc->symbolTable[p].offset);
+
+    // step 3: the body
+    endLabel = genLabel();
+    cc->inlining = 1;
+    cc->returnLabel = endLabel;
+    processStatement(body);
+    cc->inlining = 0;
+    emitLabel(endLabel);
+    leaveScope();
+    cc->offset = offset;
+    return 1;
+}
+
 //////////////////////////////////////////////////////////////////////////// function
-void processSimpleParamVariable(Node *ptr, int typeSpecifier, int typeQualifier)
+void processSimpleParamVariable(int ptr, int typeSpecifier, int typeQualifier)
 {
-    Node *p = ptr->son;     // variable name(=> identifier)
-    int stIndex, size;
+    int p = SON(ptr);     // variable name(=> identifier)
+    int size;
 
-    if(ptr->token.number != SIMPLE_VAR) printf("error in SIMPLE_VAR\n");
+    if(KIND(ptr) != SIMPLE_VAR) printf("error in SIMPLE_VAR\n");
 
     size = typeSize(typeSpecifier);
-    stIndex = insert(p->token.value.id, typeSpecifier, typeQualifier,
-            base, offset, 0, 0);
-    offset += size;
+    insert(VALUE(p), typeSpecifier, typeQualifier,
+            cc->base, cc->offset, 0, 0);
+    cc->offset += size;
 }
 
-void processArrayParamVariable(Node *ptr, int typeSpecifier, int typeQualifier)
+void processArrayParamVariable(int ptr, int typeSpecifier, int typeQualifier)
 {
-    Node *p = ptr->son; // variable name(=> identifier)
-    int stIndex, size;
+    int p = SON(ptr); // variable name(=> identifier)
+    int size;
 
-    if(ptr->token.number != ARRAY_VAR) {
+    if(KIND(ptr) != ARRAY_VAR) {
         printf("error in ARRAY_VAR\n");
         return;
     }
 
     size = typeSize(typeSpecifier);
-    stIndex = insert(p->token.value.id, typeSpecifier, typeQualifier,
-            base, offset, width, 0);
-    offset += size;
+    insert(VALUE(p), typeSpecifier, typeQualifier,
+            cc->base, cc->offset, cc->width, 0);
+    cc->offset += size;
 }
 
-void processParamDeclaration(Node *ptr)
+void processParamDeclaration(int ptr)
 {
     int typeSpecifier, typeQualifier;
-    Node *p, *q;
+    int p;
 
-    if(ptr->token.number != DCL_SPEC) icg_error(4);
+    if(KIND(ptr) != DCL_SPEC) icg_error(4);
 
     // printf("processParamDeclaration\n");
     // step 1: process DCL_SPEC
     typeSpecifier = INT_TYPE; // default type
     typeQualifier = VAR_TYPE;
-    p = ptr->son;
+    p = SON(ptr);
     while(p) {
-        if(p->token.number == INT_NODE) typeSpecifier = INT_TYPE;
-        else if(p->token.number == CONST_NODE)
+        if(KIND(p) == INT_NODE) typeSpecifier = INT_TYPE;
+        else if(KIND(p) == CONST_NODE)
             typeQualifier = CONST_TYPE;
         else { // AUTO, EXTERN, REGISTER, FLOAT, DOUBLE, SIGNED, UNSIGEND
             printf("not yet implemented\n");
             return;
         }
-        p = p->brother;
+        p = BROTHER(p);
     }
 
     // step 2: process SIMPLE_VAR, ARRAY_VAR
-    p = ptr->brother; // SIMPLE_VAR or ARRAY_VAR
-    switch(p->token.number) {
+    p = BROTHER(ptr); // SIMPLE_VAR or ARRAY_VAR
+    switch(KIND(p)) {
         case SIMPLE_VAR: // simple variable
             processSimpleParamVariable(p, typeSpecifier, typeQualifier);
             break;
@@ -658,151 +2050,156 @@ void processParamDeclaration(Node *ptr)
             break;
     }
 }
-void emitFunc(char *FuncName, int operand1, int operand2, int operand3)
-{
-    int label;
-    label = strlen(FuncName);
-    fprintf(ucodeFile, "%s", FuncName);
-    for(; label < LABEL_SIZE+1; label++)
-        fprintf(ucodeFile, " ");
-    fprintf(ucodeFile, "proc %d %d %d\n", operand1, operand2, operand3);
-}
-
-void processFuncHeader(Node *ptr)
+void processFuncHeader(int ptr)
 {
     int noArguments, returnType;
-    int stIndex;
-    Node *p;
+    int p;
 
     // printf("processFuncHeader\n");
-    if(ptr->token.number != FUNC_HEAD)
+    if(KIND(ptr) != FUNC_HEAD)
         printf("error in processFuncHeader\n");
     // step 1: process the function return type
-    p = ptr->son->son;
+    returnType = INT_TYPE; // default type
+    p = SON(SON(ptr));
     while(p) {
-        if(p->token.number == INT_NODE) returnType = INT_TYPE;
-        else if(p->token.number == VOID_NODE) returnType = VOID_TYPE;
+        if(KIND(p) == INT_NODE) returnType = INT_TYPE;
+        else if(KIND(p) == VOID_NODE) returnType = VOID_TYPE;
         else printf("invalid function return type\n");
-        p = p->brother;
+        p = BROTHER(p);
     }
 
     // step 2: count the number of formal parameters
-    p = ptr->son->brother->brother; // FORMAL_PARA
-    p = p->son; // PARAM_DCL
+    p = BROTHER(BROTHER(SON(ptr))); // FORMAL_PARA
+    p = SON(p); // PARAM_DCL
 
     noArguments = 0;
     while(p) {
         noArguments++;
-        p = p->brother;
+        p = BROTHER(p);
     }
 
     // step 3: insert the function name
-    stIndex = insert(ptr->son->brother->token.value.id, returnType, FUNC_TYPE,
+    insert(VALUE(BROTHER(SON(ptr))), returnType, FUNC_TYPE,
             1/*base*/, 0/*offset*/, noArguments/*width*/, 0/*initialValue*/);
     // if(!strcmp("main", functionName)) mainExist = 1;
 }
 
-void processFunction(Node *ptr)
+void processFunction(int ptr)
 {
-    Node *p, *q;
+    int p, q;
     int sizeOfVar = 0;
     int numOfVar = 0;
-    int stIndex;
+    int stIndex, start, noParams;
 
-    base++;
-    offset = 1;
+    cc->base++;
+    cc->offset = 1;
+    enterScope();
 
-    if(ptr->token.number != FUNC_DEF) icg_error(4);
+    if(KIND(ptr) != FUNC_DEF) icg_error(4);
 
     // step 1: process formal parameters
-    p = ptr->son->son->brother->brother; // FORMAL_PARA
-    p = p->son; // PARAM_DCL
+    p = BROTHER(BROTHER(SON(SON(ptr)))); // FORMAL_PARA
+    p = SON(p); // PARAM_DCL
     while(p) {
-        if(p->token.number == PARAM_DCL) {
-            processParamDeclaration(p->son); // DCL_SPEC
+        if(KIND(p) == PARAM_DCL) {
+            processParamDeclaration(SON(p)); // DCL_SPEC
             sizeOfVar++;
             numOfVar++;
         }
-        p = p->brother;
+        p = BROTHER(p);
     }
 
+    noParams = sizeOfVar;
+
     // step 2: process the declaration part in function body
-    p = ptr->son->brother->son->son; // DCL
+    p = SON(SON(BROTHER(SON(ptr)))); // DCL
     while(p) {
-        if(p->token.number == DCL) {
-            processDeclaration(p->son);
-            q = p->son->brother;
+        if(KIND(p) == DCL) {
+            processDeclaration(SON(p));
+            q = BROTHER(SON(p));
             while(q) {
-                if(q->token.number == DCL_ITEM) {
-                    if(q->son->token.number == ARRAY_VAR) {
-                        sizeOfVar += q->son->son->brother->token.value.num;
+                if(KIND(q) == DCL_ITEM) {
+                    if(KIND(SON(q)) == ARRAY_VAR) {
+                        sizeOfVar += VALUE(BROTHER(SON(SON(q))));
                     }
                     else {
                         sizeOfVar += 1;
                     }
                     numOfVar++;
                 }
-                q = q->brother;
+                q = BROTHER(q);
             }
         }
-        p = p->brother;
+        p = BROTHER(p);
     }
 
     // step 3: emit the function start code
-    p = ptr->son->son->brother;	// IDENT
-    emitFunc(p->token.value.id, sizeOfVar, base, 2);
-    for(stIndex = stTop-numOfVar; stIndex<stTop; stIndex++) {
-        emit3(sym, symbolTable[stIndex].base, symbolTable[stIndex].offset, symbolTable[stIndex].width);
+    p = BROTHER(SON(SON(ptr)));	// IDENT
+    start = cc->codeCount;
+    emitFunc(VALUE(p), sizeOfVar, cc->base, 2);
+    for(stIndex = cc->stTop-numOfVar; stIndex<cc->stTop; stIndex++) {
+        emit3(sym, cc->symbolTable[stIndex].base, cc->symbolTable[stIndex].offset, cc->symbolTable[stIndex].width);
     }
 
     // step 4: process the statement part in function body
-    p = ptr->son->brother;	// COMPOUND_ST
+    p = BROTHER(SON(ptr));	// COMPOUND_ST
+    if(optimize) foldFunction(p);
+    cc->frameTop = cc->offset;
     processStatement(p);
+    cc->code[start].operand[0] += cc->frameTop - cc->offset;   // temporaries
 
     // step 5: check if return type and return value
-    p = ptr->son->son;	// DCL_SPEC
-    if(p->token.number == DCL_SPEC) {
-        p = p->son;
-        if(p->token.number == VOID_NODE)
+    p = SON(SON(ptr));	// DCL_SPEC
+    if(KIND(p) == DCL_SPEC) {
+        p = SON(p);
+        if(KIND(p) == VOID_NODE)
             emit0(ret);
-        else if(p->token.number == CONST_NODE) {
-            if(p->brother->token.number == VOID_NODE)
+        else if(KIND(p) == CONST_NODE) {
+            if(KIND(BROTHER(p)) == VOID_NODE)
                 emit0(ret);
         }
     }
 
     // step 6: generate the ending codes
     emit0(endop);
-    base--;
-    symLevel++;
+    if(optimize) {
+        peephole(start);
+        removeDeadCode(start, noParams);
+    }
+    leaveScope();
+    cc->base--;
 }
 
 void genSym(int base)
 {
+    (void)base;
 }
 
-void codeGen(Node *ptr)
+void codeGen(int ptr)
 {
-    Node *p;
+    int p;
     int globalSize;
 
     initSymbolTable();
     // step 1: process the declaration part
-    for(p=ptr->son; p; p=p->brother) {
-        if(p->token.number == DCL) processDeclaration(p->son);
-        else if(p->token.number == FUNC_DEF) processFuncHeader(p->son);
+    for(p=SON(ptr); p; p=BROTHER(p)) {
+        if(KIND(p) == DCL) processDeclaration(SON(p));
+        else if(KIND(p) == FUNC_DEF) {
+            processFuncHeader(SON(p));
+            cc->symbolTable[cc->stTop - 1].definition = p;
+        }
         else icg_error(3);
     }
 
     // dumpSymbolTable();
-    globalSize = offset-1;
+    globalSize = cc->offset-1;
     // printf("size of global variables = %d\n", globalSize);
 
-    genSym(base);
+    genSym(cc->base);
 
     // step 2: process the function part
-    for(p=ptr->son; p; p=p->brother)
-        if(p->token.number == FUNC_DEF) processFunction(p);
+    for(p=SON(ptr); p; p=BROTHER(p))
+        if(KIND(p) == FUNC_DEF) processFunction(p);
     // if(!mainExist) warningmsg("main does not exist");
 
     // step 3: generate code for starting routine
@@ -812,41 +2209,242 @@ void codeGen(Node *ptr)
     //      end
     emit1(bgn, globalSize);
     emit0(ldp);
-    emitJump(call, "main");
+    emitCall(intern("main", 4));
     emit0(endop);
 }
 
+// source name with its extension replaced by ext
+void outputName(char *name, char *sourceName, char *ext)
+{
+    char *dot;
+
+    strcpy(name, sourceName);
+    dot = strrchr(name, '.');
+    if(dot && !strchr(dot, '/')) *dot = '\0';
+    strcat(name, ext);
+}
+
+int parseThreads = 1;          // threads for the parse of one source
+int tableParser;                // parse with parser() and its table
+int dumpAst;                    // write the tree as text(.ast)
+int saveAst;                    // write the tree in binary(.astb)
+int saveObject;                 // write the binary object file(.uob)
+
+// releases the compilation of the calling thread, returns failed
+int endCompilation(int failed)
+{
+    free(cc->code);
+    free(cc->reductions);
+    free(cc->addresses);
+    freeSymbolTable();
+    freeCompilation(cc);
+    cc = NULL;
+    return failed;
+}
+
+// compile one source file, or a tree saved with -b(.astb), on the
+// calling thread. returns 0 on success. a source with errors gets no
+// output files, those of an earlier compilation are removed.
+int compile(char *sourceName)
+{
+    char fileName[NAME_SIZE + 8];
+    char *ext;
+    FILE *fp;
+    int root, loaded, written;
+
+    if(strlen(sourceName) > NAME_SIZE) {
+        icg_error(2);
+        return 1;
+    }
+    ext = strrchr(sourceName, '.');
+    loaded = ext && !strcmp(ext, ".astb");
+    cc = newCompilation();
+    if(loaded) {
+        if(!(fp = fopen(sourceName, "rb"))) {
+            icg_error(2);
+            return endCompilation(1);
+        }
+        printf(" === loading AST: %s\n", sourceName);
+        root = loadTree(fp);
+        fclose(fp);
+        if(!root) {
+            icg_error(6);
+            return endCompilation(1);
+        }
+    }
+    else {
+        if(!openSource(sourceName)) {
+            icg_error(2);
+            return endCompilation(1);
+        }
+        printf(" === start of Parser: %s\n", sourceName);
+        lexicalErrors = 0;
+        root = tableParser ? parser() : splitParser(parseThreads);
+        closeSource();
+        if(!root || cc->errcnt || lexicalErrors) {
+            printf(" *** %s: %d syntax error(s), %d lexical error(s), no code generated\n",
+                    sourceName, cc->errcnt, lexicalErrors);
+            outputName(fileName, sourceName, ".uco");
+            remove(fileName);
+            outputName(fileName, sourceName, ".uob");
+            remove(fileName);
+            return endCompilation(1);
+        }
+    }
+
+    if(dumpAst) {
+        outputName(fileName, sourceName, ".ast");
+        if(!(cc->astFile = fopen(fileName, "w"))) {
+            icg_error(2);
+            return endCompilation(1);
+        }
+        printTree(root, 0);
+        fclose(cc->astFile);
+    }
+    if(saveAst && !loaded) {
+        outputName(fileName, sourceName, ".astb");
+        if(!(fp = fopen(fileName, "wb"))) {
+            icg_error(2);
+            return endCompilation(1);
+        }
+        written = saveTree(fp, root);
+        fclose(fp);
+        if(!written) {
+            icg_error(2);
+            return endCompilation(1);
+        }
+    }
+
+    outputName(fileName, sourceName, ".uco");
+    if(!(cc->ucodeFile = fopen(fileName, "w"))) {
+        icg_error(2);
+        return endCompilation(1);
+    }
+    printf(" === start of ICG: %s\n", sourceName);
+    codeGen(root);
+    writeCode(cc->ucodeFile);
+    fclose(cc->ucodeFile);
+    if(saveObject) {
+        outputName(fileName, sourceName, ".uob");
+        if(!(fp = fopen(fileName, "wb"))) {
+            icg_error(2);
+            return endCompilation(1);
+        }
+        written = writeObject(fp);
+        fclose(fp);
+        if(!written) {
+            icg_error(2);
+            return endCompilation(1);
+        }
+    }
+    nodeStatistics(stdout);
+    return endCompilation(0);
+}
+
+//////////////////////////////////////////////////////////////////////////// Driver
+// several source files are compiled at once by a pool of threads, each
+// takes the next file that is not compiled yet.
+char **sourceNames;
+int noSources, nextSource, failures;
+
+#ifndef _WIN32
+pthread_mutex_t driverLock = PTHREAD_MUTEX_INITIALIZER;
+
+void *compileWorker(void *arg)
+{
+    int i;
+
+    (void)arg;
+    while(1) {
+        pthread_mutex_lock(&driverLock);
+        i = nextSource++;
+        pthread_mutex_unlock(&driverLock);
+        if(i >= noSources) break;
+        if(compile(sourceNames[i])) {
+            pthread_mutex_lock(&driverLock);
+            failures++;
+            pthread_mutex_unlock(&driverLock);
+        }
+    }
+    return NULL;
+}
+
+void compileAll(int noThreads)
+{
+    pthread_t *threads;
+    int i;
+
+    threads = (pthread_t*)malloc(noThreads * sizeof(pthread_t));
+    if(!threads) {
+        printf("malloc error in compileAll()\n");
+        exit(1);
+    }
+    for(i = 0; i < noThreads; i++)
+        if(pthread_create(&threads[i], NULL, compileWorker, NULL)) {
+            printf("pthread_create error in compileAll()\n");
+            exit(1);
+        }
+    for(i = 0; i < noThreads; i++)
+        pthread_join(threads[i], NULL);
+    free(threads);
+}
+#else
+void compileAll(int noThreads)
+{
+    for(; nextSource < noSources; nextSource++)
+        failures += compile(sourceNames[nextSource]);
+}
+#endif
+
+// icg [-a] [-b] [-O] [-t] [-u] [-j threads] [-p threads] file.mc|file.astb ...
+//   -a: write the tree as text(file.ast)
+//   -b: write the tree in binary(file.astb), icg compiles it without
+//       parsing when it is given instead of the source
+//   -O: optimize the generated code
+//   -t: parse with the table driven parser()(the packed table, or the
+//       dense one in a build with -DDENSE_TABLE) in place of the
+//       generated directParser()
+//   -u: write the binary object file(file.uob) besides file.uco, ucodei
+//       runs it without assembling the text
+//   -j: sources compiled at the same time
+//   -p: threads that parse one source(see SplitParser.c)
 int main(int argc, char *argv[])
 {
-    char fileName[30];
-    Node *root;
+    int noThreads = 0;
+    int i;
 
     printf(" *** start of Mini C Compiler\n");
-    if(argc != 2) {
+    for(i = 1; i < argc - 1 && argv[i][0] == '-'; i++) {
+        if(!strcmp(argv[i], "-a")) dumpAst = 1;
+        else if(!strcmp(argv[i], "-b")) saveAst = 1;
+        else if(!strcmp(argv[i], "-t")) tableParser = 1;
+        else if(!strcmp(argv[i], "-u")) saveObject = 1;
+        else if(!strcmp(argv[i], "-O")) optimize = 1;
+        else if(!strcmp(argv[i], "-j")) noThreads = atoi(argv[++i]);
+        else if(!strcmp(argv[i], "-p")) parseThreads = atoi(argv[++i]);
+        else break;
+    }
+    if(i >= argc) {
         icg_error(1);
         exit(1);
     }
-    strcpy(fileName, argv[1]);
-    printf("   * source file name: %s\n", fileName);
+    sourceNames = &argv[i];
+    noSources = argc - i;
+    for(i = 0; i < noSources; i++)
+        printf("   * source file name: %s\n", sourceNames[i]);
 
-    freopen(fileName, "r", stdin); // stdin redirect
-    if((sourceFile = fopen(fileName, "r")) == NULL) {
-        icg_error(2);
-        exit(1);
-    }
-    astFile = fopen(strcat(strtok(fileName, "."), ".ast"),  "w");
-    ucodeFile = fopen(strcat(strtok(fileName, "."), ".uco"),  "w");
+    // shared tables are built before any thread starts
+    initParsingTable();
 
-    printf(" === start of Parser\n");
-    root = parser();
-    printTree(root, 0);
-    printf(" === start of ICG\n");
-    codeGen(root);
+    if(noSources == 1) failures = compile(sourceNames[0]);
+    else {
+#ifndef _WIN32
+        if(noThreads <= 0) noThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+        if(noThreads <= 0) noThreads = 1;
+        if(noThreads > noSources) noThreads = noSources;
+        compileAll(noThreads);
+    }
     printf(" *** end of Mini C Compiler\n");
-
-    fclose(sourceFile);
-    fclose(astFile);
-    fclose(ucodeFile);
-    return 0;
+    return failures ? 1 : 0;
 }
-
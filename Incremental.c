@@ -0,0 +1,303 @@
+/*
+ * Incremental front end
+ *
+ * keeps the token stream and the AST of a source between compilations.
+ * after an edit only the damaged tokens are scanned again, starting at
+ * the last token that ends before the edit and stopping as soon as a
+ * new token starts where an old token after the edit started(from there
+ * on the old tokens are still valid). the top-level declarations that
+ * contain new tokens are parsed again and their subtrees are spliced
+ * into the PROGRAM node in place of the old ones.
+ */
+#include "Incremental.h"
+
+// per thread like the scanner, so that each thread can keep its own units
+static THREAD_LOCAL struct lexToken *lexBuf;    // tokens of the region, absolute offsets
+static THREAD_LOCAL int lexCount, lexSize;
+
+static THREAD_LOCAL struct lexToken *feed;      // token source of parser()
+static THREAD_LOCAL int feedCount, feedIndex;
+
+static void appendToken(struct tokenType token, long start, long end)
+{
+    if (lexCount == lexSize) {
+        lexSize = lexSize ? lexSize * 2 : 4096;
+        lexBuf = (struct lexToken*)realloc(lexBuf, lexSize * sizeof(struct lexToken));
+        if (!lexBuf) {
+            printf("realloc error in appendToken()\n");
+            exit(1);
+        }
+    }
+    lexBuf[lexCount].token = token;
+    lexBuf[lexCount].start = start;
+    lexBuf[lexCount].end = end;
+    lexCount++;
+}
+
+static struct tokenType feedToken()
+{
+    struct tokenType token;
+
+    if (feedIndex < feedCount) return feed[feedIndex++].token;
+    token.number = teof;
+    return token;
+}
+
+// parse tokens as a translation unit, returns the PROGRAM node
+static int parseTokens(struct lexToken *tokens, int count)
+{
+    int root;
+
+    feed = tokens; feedCount = count; feedIndex = 0;
+    cc->nextToken = feedToken;
+    root = parser();
+    cc->nextToken = scanner;
+    return root;
+}
+
+static void freeDcl(ExternalDcl *dcl)
+{
+    free(dcl->tokens);
+    dcl->tokens = NULL;
+}
+
+// cut the tokens into top-level declarations: a ';' at brace depth
+// zero or the '}' that brings the depth back to zero ends one.
+// the declarations are stored from dcls[0] on, returns their number.
+static int splitDcls(struct lexToken *tokens, int count, ExternalDcl *dcls)
+{
+    int i, j, first, depth, n, number;
+    ExternalDcl *d;
+
+    n = depth = first = 0;
+    for (i = 0; i < count; i++) {
+        number = tokens[i].token.number;
+        if (number == tlbrace) depth++;
+        else if (number == trbrace) depth--;
+        if (i < count - 1 && !(depth == 0 && (number == tsemicolon || number == trbrace)))
+            continue;
+
+        d = &dcls[n++];
+        d->node = 0;
+        d->start = tokens[first].start;
+        d->end = tokens[i].end;
+        d->noTokens = i - first + 1;
+        d->tokens = (struct lexToken*)malloc(d->noTokens * sizeof(struct lexToken));
+        if (!d->tokens) {
+            printf("malloc error in splitDcls()\n");
+            exit(1);
+        }
+        for (j = 0; j < d->noTokens; j++) {
+            d->tokens[j] = tokens[first + j];
+            d->tokens[j].start -= d->start;
+            d->tokens[j].end -= d->start;
+        }
+        first = i + 1;
+    }
+    return n;
+}
+
+static int countDcls(struct lexToken *tokens, int count)
+{
+    int i, n, depth;
+
+    n = depth = 0;
+    for (i = 0; i < count; i++) {
+        if (tokens[i].token.number == tlbrace) depth++;
+        else if (tokens[i].token.number == trbrace) depth--;
+        if ((depth == 0 && (tokens[i].token.number == tsemicolon
+                || tokens[i].token.number == trbrace)) || i == count - 1)
+            n++;
+    }
+    return n;
+}
+
+static void reserveDcls(IncrementalUnit *u, int n)
+{
+    if (n <= u->dclsSize) return;
+    u->dclsSize = n > 2 * u->dclsSize ? n : 2 * u->dclsSize;
+    u->dcls = (ExternalDcl*)realloc(u->dcls, u->dclsSize * sizeof(ExternalDcl));
+    if (!u->dcls) {
+        printf("realloc error in reserveDcls()\n");
+        exit(1);
+    }
+}
+
+// attach the sons of a PROGRAM node to dcls[first..first+n-1],
+// returns 0 if their number differs(error recovery dropped some).
+static int attachNodes(ExternalDcl *dcls, int n, int program)
+{
+    int p;
+    int i;
+
+    p = program ? SON(program) : 0;
+    for (i = 0; i < n && p; i++, p = BROTHER(p))
+        dcls[i].node = p;
+    return i == n && p == 0;
+}
+
+// scan and parse the whole text
+static int rebuild(IncrementalUnit *u)
+{
+    struct tokenType token;
+    int i;
+
+    for (i = 0; i < u->noDcls; i++) freeDcl(&u->dcls[i]);
+    u->noDcls = 0;
+
+    setSource(u->text, u->length);
+    lexCount = 0;
+    while ((token = scanner()).number != teof)
+        appendToken(token, tokenStart - u->text, cp - u->text);
+
+    reserveDcls(u, countDcls(lexBuf, lexCount));
+    u->noDcls = splitDcls(lexBuf, lexCount, u->dcls);
+    u->root = parseTokens(lexBuf, lexCount);
+    u->incremental = attachNodes(u->dcls, u->noDcls, u->root);
+    return u->root;
+}
+
+int incrementalParse(IncrementalUnit *u, char *text, long length)
+{
+    u->size = length + 1;
+    u->text = (char*)malloc(u->size);
+    if (!u->text) {
+        printf("malloc error in incrementalParse()\n");
+        exit(1);
+    }
+    memcpy(u->text, text, length);
+    u->length = length;
+    u->root = 0;
+    u->dcls = NULL;
+    u->noDcls = u->dclsSize = 0;
+    return rebuild(u);
+}
+
+void incrementalFree(IncrementalUnit *u)
+{
+    int i;
+
+    for (i = 0; i < u->noDcls; i++) freeDcl(&u->dcls[i]);
+    free(u->dcls);
+    free(u->text);
+    u->dcls = NULL;
+    u->text = NULL;
+    u->noDcls = u->dclsSize = 0;
+}
+
+static void editText(IncrementalUnit *u, long start, long removed, char *text, long inserted)
+{
+    long length = u->length - removed + inserted;
+
+    if (length + 1 > u->size) {
+        u->size = length + 1 > 2 * u->size ? length + 1 : 2 * u->size;
+        u->text = (char*)realloc(u->text, u->size);
+        if (!u->text) {
+            printf("realloc error in editText()\n");
+            exit(1);
+        }
+    }
+    memmove(u->text + start + inserted, u->text + start + removed,
+            u->length - start - removed);
+    memcpy(u->text + start, text, inserted);
+    u->length = length;
+}
+
+// replace text[start, start+removed) by text[0, inserted) and bring the
+// tree up to date, returns the PROGRAM node.
+int incrementalEdit(IncrementalUnit *u, long start, long removed,
+        char *text, long inserted)
+{
+    struct tokenType token;
+    ExternalDcl *newDcls;
+    int program, pred, succ, p;
+    long delta = inserted - removed;
+    long pos, ts, oldStart;
+    int a, b, d, t, i, n;
+
+    editText(u, start, removed, text, inserted);
+    if (!u->incremental || u->noDcls == 0) return rebuild(u);
+
+    // step 1: the last declaration starting before the edit
+    for (a = u->noDcls - 1; a > 0 && u->dcls[a].start >= start; a--);
+
+    // step 2: keep its tokens that end before the edit
+    lexCount = 0;
+    pos = u->dcls[a].start < start ? u->dcls[a].start : 0;
+    for (t = 0; t < u->dcls[a].noTokens
+            && u->dcls[a].start + u->dcls[a].tokens[t].end < start; t++) {
+        appendToken(u->dcls[a].tokens[t].token, u->dcls[a].start + u->dcls[a].tokens[t].start,
+                u->dcls[a].start + u->dcls[a].tokens[t].end);
+        pos = u->dcls[a].start + u->dcls[a].tokens[t].end;
+    }
+
+    // step 3: scan until a new token starts where an old one did
+    d = a;
+    setSource(u->text, u->length);
+    while (1) {
+        cp = u->text + pos;
+        token = scanner();
+        if (token.number == teof) {
+            d = u->noDcls;
+            break;
+        }
+        ts = tokenStart - u->text;
+        for (; d < u->noDcls; t = 0, d++) {
+            for (; t < u->dcls[d].noTokens; t++) {
+                oldStart = u->dcls[d].start + u->dcls[d].tokens[t].start;
+                if (oldStart >= start + removed && oldStart + delta >= ts) break;
+            }
+            if (t < u->dcls[d].noTokens) break;
+        }
+        if (d < u->noDcls && u->dcls[d].start + u->dcls[d].tokens[t].start + delta == ts)
+            break;  // synchronized with the old token stream
+        appendToken(token, ts, cp - u->text);
+        pos = cp - u->text;
+    }
+
+    // step 4: the rest of the declaration the scan stopped in is kept
+    if (d < u->noDcls && t == 0) b = d - 1;
+    else {
+        b = d < u->noDcls ? d : u->noDcls - 1;
+        for (; d < u->noDcls && t < u->dcls[d].noTokens; t++)
+            appendToken(u->dcls[d].tokens[t].token,
+                    u->dcls[d].start + u->dcls[d].tokens[t].start + delta,
+                    u->dcls[d].start + u->dcls[d].tokens[t].end + delta);
+    }
+
+    // step 5: parse the declarations a..b again
+    n = lexCount ? countDcls(lexBuf, lexCount) : 0;
+    newDcls = (ExternalDcl*)malloc((n ? n : 1) * sizeof(ExternalDcl));
+    if (!newDcls) {
+        printf("malloc error in incrementalEdit()\n");
+        exit(1);
+    }
+    n = splitDcls(lexBuf, lexCount, newDcls);
+    program = n ? parseTokens(lexBuf, lexCount) : 0;
+    if (!attachNodes(newDcls, n, program)) {
+        for (i = 0; i < n; i++) freeDcl(&newDcls[i]);
+        free(newDcls);
+        return rebuild(u);
+    }
+
+    // step 6: splice the new subtrees into the PROGRAM node
+    pred = a > 0 ? u->dcls[a - 1].node : 0;
+    succ = b + 1 < u->noDcls ? u->dcls[b + 1].node : 0;
+    p = n ? newDcls[0].node : succ;
+    if (pred) BROTHER(pred) = p;
+    else SON(u->root) = p;
+    if (n) BROTHER(newDcls[n - 1].node) = succ;
+
+    // step 7: replace dcls[a..b], the following ones only move
+    for (i = a; i <= b; i++) freeDcl(&u->dcls[i]);
+    reserveDcls(u, u->noDcls - (b - a + 1) + n);
+    memmove(&u->dcls[a + n], &u->dcls[b + 1], (u->noDcls - b - 1) * sizeof(ExternalDcl));
+    memcpy(&u->dcls[a], newDcls, n * sizeof(ExternalDcl));
+    u->noDcls += n - (b - a + 1);
+    for (i = a + n; i < u->noDcls; i++) {
+        u->dcls[i].start += delta;
+        u->dcls[i].end += delta;
+    }
+    free(newDcls);
+    return u->root;
+}
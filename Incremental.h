@@ -0,0 +1,31 @@
+#include "Parser.h"
+
+// a token kept between compilations, offsets are relative to the
+// start of its declaration so later edits only move the declaration.
+struct lexToken {
+    struct tokenType token;
+    int start, end;
+};
+
+typedef struct externalDcl {
+    int node;                   // FUNC_DEF or DCL subtree under PROGRAM
+    long start, end;            // source range of its tokens
+    struct lexToken *tokens;
+    int noTokens;
+} ExternalDcl;
+
+typedef struct incrementalUnit {
+    char *text;                 // current source text
+    long length, size;
+    int root;                   // PROGRAM node
+    ExternalDcl *dcls;          // top-level declarations in source order
+    int noDcls, dclsSize;
+    int incremental;            // 0 if the tree does not line up with dcls
+} IncrementalUnit;
+
+int incrementalParse(IncrementalUnit *u, char *text, long length);
+int incrementalEdit(IncrementalUnit *u, long start, long removed,
+        char *text, long inserted);
+// the nodes live in the node array of the current compilation(cc),
+// shared by all units; replaced subtrees stay there until freeNodes()
+void incrementalFree(IncrementalUnit *u);
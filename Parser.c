@@ -76,11 +76,45 @@ char *tokenName[] = {
     "while",    "{",    "||",   "}"
 };
 
-int errcnt = 0;
-int sp;                     // stack pointer
-int stateStack[PS_SIZE];    // state stack
-int symbolStack[PS_SIZE];   // symbol stack
-Node* valueStack[PS_SIZE];    // value stack
+THREAD_LOCAL Compilation *cc;   // compilation of this thread
+
+Compilation *newCompilation()
+{
+    Compilation *c;
+
+    c = (Compilation*)calloc(1, sizeof(Compilation));
+    if(!c) {
+        printf("calloc error in newCompilation()\n");
+        exit(1);
+    }
+    c->nextToken = scanner;
+    c->base = c->offset = c->width = 1;
+    return c;
+}
+
+// the symbol table and the files belong to the code generator
+void freeCompilation(Compilation *c)
+{
+    free(c->stateStack);
+    free(c->symbolStack);
+    free(c->valueStack);
+    free(c->tailStack);
+    free(c->nodes);
+    free(c);
+}
+
+void growStacks()
+{
+    cc->stackSize = cc->stackSize ? 2 * cc->stackSize : PS_SIZE;
+    cc->stateStack = (int*)realloc(cc->stateStack, cc->stackSize * sizeof(int));
+    cc->symbolStack = (int*)realloc(cc->symbolStack, cc->stackSize * sizeof(int));
+    cc->valueStack = (int*)realloc(cc->valueStack, cc->stackSize * sizeof(int));
+    cc->tailStack = (int*)realloc(cc->tailStack, cc->stackSize * sizeof(int));
+    if(!cc->stateStack || !cc->symbolStack || !cc->valueStack || !cc->tailStack) {
+        printf("realloc error in growStacks()\n");
+        exit(1);
+    }
+}
 
 void semantic(int n)
 {
@@ -90,7 +124,7 @@ void semantic(int n)
 void printToken(struct tokenType token)
 {
     if (token.number == tident)
-        printf("%s", token.value.id);
+        printf("%s", idName(token.value.id));
     else if (token.number == tnumber)
         printf("%d", token.value.num);
     else
@@ -101,20 +135,21 @@ void dumpStack()
 {
     int i, start;
 
-    if (sp > 10) start = sp - 10;
+    if (cc->sp > 10) start = cc->sp - 10;
     else start = 0;
 
     printf("\n *** dump state stack :");
-    for (i = start; i <= sp; i++)
-        printf(" %d", stateStack[i]);
+    for (i = start; i <= cc->sp; i++)
+        printf(" %d", cc->stateStack[i]);
 
     printf("\n *** dump symbol stack :");
-    for (i = start; i <= sp; i++)
-        printf(" %d", symbolStack[i]);
+    for (i = start; i <= cc->sp; i++)
+        printf(" %d", cc->symbolStack[i]);
     printf("\n");
 }
 
-void errorRecovery()
+// returns 0 if the source ends first, the parse of it gives up
+int errorRecovery()
 {
     struct tokenType tok;
     int parenthesisCount, braceCount;
@@ -123,8 +158,8 @@ void errorRecovery()
     // step 1: skip to the semicolon
     parenthesisCount = braceCount = 0;
     while (1) {
-        tok = scanner();
-        if (tok.number == teof) exit(1);
+        tok = cc->nextToken();
+        if (tok.number == teof) return 0;
         if (tok.number == tlparen) parenthesisCount++;
         else if (tok.number == trparen) parenthesisCount--;
         if (tok.number == tlbrace) braceCount++;
@@ -134,27 +169,28 @@ void errorRecovery()
     }
 
     // step 2: adjust state stack
-    for (i = sp; i >= 0; i--) {
+    for (i = cc->sp; i >= 0; i--) {
         // statement_list -> statement_list . statement
-        if (stateStack[i] == 36) break; // second statement part
+        if (cc->stateStack[i] == 36) break; // second statement part
 
         // statement_list -> . statement
         // statement_list -> . statement_list statement
-        if (stateStack[i] == 24) break; // first statement part
+        if (cc->stateStack[i] == 24) break; // first statement part
 
         // declaration_list -> declaration_list . declaration
-        if (stateStack[i] == 25) break; // second internal dcl
+        if (cc->stateStack[i] == 25) break; // second internal dcl
 
         // declaration_list -> . declaration
         // declaration_list -> . declaration_list declaration
-        if (stateStack[i] == 17) break; // internal declaration
+        if (cc->stateStack[i] == 17) break; // internal declaration
 
         // external declaration
         // external_dcl -> . declaration
-        if (stateStack[i] == 2) break;  // after first external dcl
-        if (stateStack[i] == 0) break;  // first external declaration
+        if (cc->stateStack[i] == 2) break;  // after first external dcl
+        if (cc->stateStack[i] == 0) break;  // first external declaration
     }
-    sp = i;
+    cc->sp = i;
+    return 1;
 }
 
 //SDT
@@ -164,116 +200,506 @@ int meaningfulToken(struct tokenType token)
     else return 0;
 }
 
-Node* buildNode(struct tokenType token)
+// node array: every Node of a compilation is kept in one array that
+// doubles when it is full and is released at once by freeNodes().
+// trees refer to nodes by index, so growing the array moves nothing.
+#define NODE_INIT 4096          // initial number of nodes
+
+// room for n more nodes
+void reserveNodes(long n)
 {
-    Node *ptr;
-    ptr = (Node*)malloc(sizeof(Node));
-    if(!ptr) {
-        printf("malloc error in buildNode()\n");
+    if(cc->nodeCount + n < cc->nodeSize) return;
+    if(!cc->nodeSize) cc->nodeSize = NODE_INIT;
+    while(cc->nodeCount + n >= cc->nodeSize) cc->nodeSize *= 2;
+    cc->nodes = (Node*)realloc(cc->nodes, cc->nodeSize * sizeof(Node));
+    if(!cc->nodes) {
+        printf("realloc error in reserveNodes()\n");
         exit(1);
     }
-    ptr->token = token;
-    ptr->noderep = terminal;
-    ptr->son = ptr->brother = NULL;
+    cc->nodeGrowths++;
+}
+
+int newNode()
+{
+    if(cc->nodeCount + 1 >= cc->nodeSize) reserveNodes(1);
+    return ++cc->nodeCount;
+}
+
+void freeNodes()
+{
+    free(cc->nodes);
+    cc->nodes = NULL;
+    cc->nodeCount = cc->nodeSize = 0;
+}
+
+void nodeStatistics(FILE *fp)
+{
+    fprintf(fp, "   * AST nodes: %ld nodes(%ld bytes), %ld allocated(%ld bytes) in %ld reallocs\n",
+            cc->nodeCount, cc->nodeCount * (long)sizeof(Node),
+            cc->nodeSize, cc->nodeSize * (long)sizeof(Node), cc->nodeGrowths);
+}
+
+int buildNode(struct tokenType token)
+{
+    int ptr;
+    ptr = newNode();
+    KIND(ptr) = token.number;
+    VALUE(ptr) = token.value.num;
+    NODEREP(ptr) = terminal;
+    SON(ptr) = BROTHER(ptr) = 0;
     return ptr;
 }
 
-Node* buildTree(int nodeNumber, int rhsLength)
+// the tail stack holds the last brother of every value, so a list
+// built by a left recursive rule grows at its end in constant time.
+// *tail is set to the last brother of the returned node.
+int buildTree(int nodeNumber, int rhsLength, int *tail)
 {
     int i, j, start;
-    Node *first, *ptr;
+    int first, last, ptr;
 
-    i = sp - rhsLength + 1;
+    i = cc->sp - rhsLength + 1;
     
     // step 1: find a first index with node in value stack
-    while(i <= sp && valueStack[i] == NULL) i++;
-    if(!nodeNumber && i > sp) return NULL;
+    while(i <= cc->sp && cc->valueStack[i] == 0) i++;
+    if(!nodeNumber && i > cc->sp) {
+        *tail = 0;
+        return 0;
+    }
     start = i;
 
     // step 2: linking brothers
-    while(i <= sp-1) {
+    last = start > cc->sp ? 0 : cc->tailStack[start];
+    while(i <= cc->sp-1) {
         j = i + 1;
-        while(j <= sp && valueStack[j] == NULL) j++;
-        if(j <= sp) {
-            ptr = valueStack[i];
-            while(ptr->brother) ptr = ptr->brother;
-            ptr->brother = valueStack[j];
+        while(j <= cc->sp && cc->valueStack[j] == 0) j++;
+        if(j <= cc->sp) {
+            BROTHER(cc->tailStack[i]) = cc->valueStack[j];
+            last = cc->tailStack[j];
         }
         i = j;
     }
-    first = (start > sp) ? NULL : valueStack[start];
+    first = (start > cc->sp) ? 0 : cc->valueStack[start];
 
     // step 3: making subtree root and linking son
     if(nodeNumber) {
-        ptr = (Node*)malloc(sizeof(Node));
-        if(!ptr) {
-            printf("malloc error in buildTree()\n");
-            exit(1);
-        }
-        ptr->token.number = nodeNumber;
-        //ptr->token.tokenValue = NULL;
-        ptr->noderep = nonterm;
-        ptr->son = first;
-        ptr->brother = NULL;
+        ptr = newNode();
+        KIND(ptr) = nodeNumber;
+        VALUE(ptr) = 0;
+        NODEREP(ptr) = nonterm;
+        SON(ptr) = first;
+        BROTHER(ptr) = 0;
+        *tail = ptr;
         return ptr;
     }
-    else return first;
+    *tail = last;
+    return first;
 }
 
-void printNode(Node *pt, int indent)
+void printNode(int pt, int indent)
 {
-    extern FILE* astFile;
     int i;
 
-    for(i=1; i<=indent; i++) fprintf(astFile, " ");
-    if(pt->noderep == terminal) {
-        if(pt->token.number == tident)
-            fprintf(astFile, " Terminal: %s", pt->token.value.id);
-        else if(pt->token.number == tnumber)
-            fprintf(astFile, " Terminal: %d", pt->token.value.num);
+    for(i=1; i<=indent; i++) fprintf(cc->astFile, " ");
+    if(NODEREP(pt) == terminal) {
+        if(KIND(pt) == tident)
+            fprintf(cc->astFile, " Terminal: %s", idName(VALUE(pt)));
+        else if(KIND(pt) == tnumber)
+            fprintf(cc->astFile, " Terminal: %d", VALUE(pt));
     }
     else { // nonterminal node
         int i;
-        i = (int)(pt->token.number);
-        fprintf(astFile, " Nonterminal: %s", nodeName[i]);
+        i = (int)(KIND(pt));
+        fprintf(cc->astFile, " Nonterminal: %s", nodeName[i]);
     }
-    fprintf(astFile, "\n");
+    fprintf(cc->astFile, "\n");
 }
 
-void printTree(Node *pt, int indent)
+void printTree(int pt, int indent)
 {
-    Node *p = pt;
-    while(p != NULL) {
+    int p = pt;
+    while(p) {
         printNode(p, indent);
-        if(p->noderep == nonterm) printTree(p->son, indent+5);
-        p = p->brother;
+        if(NODEREP(p) == nonterm) printTree(SON(p), indent+5);
+        p = BROTHER(p);
+    }
+}
+
+// binary AST file: an AstHeader, the names of the ids 0..noNames-1 as
+// strings with their '\0', then nodes[1..noNodes] as they are in memory.
+typedef struct {
+    int magic, version;
+    int root;
+    int noNodes;
+    int noNames;
+    int namesLength;            // bytes of the names
+} AstHeader;
+
+// writes every node of cc and the names of the identifiers in them,
+// returns 0 on a write error
+int saveTree(FILE *fp, int root)
+{
+    AstHeader h;
+    char *names, *name;
+    int i, length;
+
+    h.magic = AST_MAGIC;
+    h.version = AST_VERSION;
+    h.root = root;
+    h.noNodes = (int)cc->nodeCount;
+    h.noNames = 0;
+    for (i = 1; i <= h.noNodes; i++)
+        if (NODEREP(i) == terminal && KIND(i) == tident && VALUE(i) >= h.noNames)
+            h.noNames = VALUE(i) + 1;
+    h.namesLength = 0;
+    for (i = 0; i < h.noNames; i++) h.namesLength += strlen(idName(i)) + 1;
+
+    names = (char*)malloc(h.namesLength + 1);
+    if (!names) {
+        printf("malloc error in saveTree()\n");
+        exit(1);
+    }
+    for (name = names, i = 0; i < h.noNames; i++) {
+        length = strlen(idName(i)) + 1;
+        memcpy(name, idName(i), length);
+        name += length;
+    }
+    i = fwrite(&h, sizeof(h), 1, fp) == 1
+        && fwrite(names, 1, h.namesLength, fp) == (size_t)h.namesLength
+        && fwrite(cc->nodes + 1, sizeof(Node), h.noNodes, fp) == (size_t)h.noNodes;
+    free(names);
+    return i;
+}
+
+// reads a tree written by saveTree() into the node array of cc after the
+// nodes that are there, returns its root or 0 if the file is not a
+// binary AST. the names are interned again and the identifier nodes get
+// the ids of this process.
+// the parsers build the sons of a node before it and its brothers after
+// it, so a son has a lower and a brother a higher index. a node with a
+// kind out of range, a link against that order or a node linked to
+// twice(a cycle or a shared subtree) is rejected.
+int loadTree(FILE *fp)
+{
+    AstHeader h;
+    char *names, *name, *end, *linked;
+    int *id, base, i, n;
+
+    if (fread(&h, sizeof(h), 1, fp) != 1 || h.magic != AST_MAGIC || h.version != AST_VERSION
+            || h.noNodes < 0 || h.noNames < 0 || h.namesLength < 0
+            || h.root <= 0 || h.root > h.noNodes)
+        return 0;
+    names = (char*)malloc(h.namesLength + 1);
+    id = (int*)malloc((h.noNames + 1) * sizeof(int));
+    if (!names || !id) {
+        printf("malloc error in loadTree()\n");
+        exit(1);
+    }
+    if (fread(names, 1, h.namesLength, fp) != (size_t)h.namesLength) h.noNames = -1;
+    end = names + h.namesLength;
+    for (name = names, i = 0; i < h.noNames; i++, name += n + 1) {
+        n = name < end ? strnlen(name, end - name) : 0;
+        if (name + n >= end) break;
+        id[i] = intern(name, n);
+    }
+    free(names);
+
+    base = (int)cc->nodeCount;
+    reserveNodes(h.noNodes + 1);
+    linked = (char*)calloc(h.noNodes + 1, 1);
+    if (!linked) {
+        printf("calloc error in loadTree()\n");
+        exit(1);
+    }
+    if (i != h.noNames
+            || fread(cc->nodes + base + 1, sizeof(Node), h.noNodes, fp) != (size_t)h.noNodes) {
+        free(id);
+        free(linked);
+        return 0;
+    }
+    linked[h.root] = 1;                 // nothing links to the root
+    for (i = base + 1; i <= base + h.noNodes; i++) {
+        n = i - base;
+        if (SON(i) < 0 || SON(i) >= n || (BROTHER(i) && (BROTHER(i) <= n || BROTHER(i) > h.noNodes)))
+            break;
+        if ((SON(i) && linked[SON(i)]++) || (BROTHER(i) && linked[BROTHER(i)]++)) break;
+        if (NODEREP(i) == terminal) {
+            if (KIND(i) < 0 || KIND(i) > trbrace || SON(i)) break;
+        }
+        else if (NODEREP(i) != nonterm || KIND(i) < 0 || KIND(i) > WHILE_ST) break;
+        if (SON(i)) SON(i) += base;
+        if (BROTHER(i)) BROTHER(i) += base;
+        if (NODEREP(i) == terminal && KIND(i) == tident) {
+            if (VALUE(i) < 0 || VALUE(i) >= h.noNames) break;
+            VALUE(i) = id[VALUE(i)];
+        }
+    }
+    free(id);
+    free(linked);
+    if (i <= base + h.noNodes) return 0;
+    cc->nodeCount = base + h.noNodes;
+    return base + h.root;
+}
+
+static void initUnitChains();
+
+#ifdef DENSE_TABLE
+#define ACTION(state, symbol)   parsingTable[state][symbol]
+#define GOTO(state, lhs)        parsingTable[state][lhs]
+void initParsingTable() { initUnitChains(); }
+#else
+// the action and goto parts of parsingTable are packed into one comb
+// vector of 16-bit entries(row displacement). an action row keeps every
+// lookahead that has an action, so a slot the state does not own is an
+// error: one read of check and entry, and an error is found in the same
+// state as with the dense table(a default reduction would reduce before
+// the error and errorRecovery() would see other stacks). a goto is never
+// taken on an error, there the most frequent goto state of a nonterminal
+// becomes its default goto.
+typedef struct {
+    short check;    // owner of the slot: a state, or NO_STATES + nonterminal
+    short entry;    // parsingTable entry
+} PackedEntry;
+
+static PackedEntry *packedTable;
+static short actionBase[NO_STATES];
+static short gotoBase[NO_SYMBOLS + 1], defaultGoto[NO_SYMBOLS + 1];
+
+#define ACTION(state, symbol) \
+    (packedTable[actionBase[state] + (symbol)].check == (state) ? \
+     packedTable[actionBase[state] + (symbol)].entry : 0)
+#define GOTO(state, lhs) \
+    (packedTable[gotoBase[lhs] + (state)].check == NO_STATES + (lhs) ? \
+     packedTable[gotoBase[lhs] + (state)].entry : defaultGoto[lhs])
+
+// most frequent nonzero value of v[0..n-1] whose sign is sign
+static int mostFrequent(int *v, int n, int sign)
+{
+    int i, j, count, best = 0, bestCount = 0;
+
+    for (i = 0; i < n; i++) {
+        if (v[i] == 0 || (v[i] > 0) != (sign > 0)) continue;
+        for (count = 0, j = i; j < n; j++)
+            if (v[j] == v[i]) count++;
+        if (count > bestCount) {
+            best = v[i];
+            bestCount = count;
+        }
+    }
+    return best;
+}
+
+// place a row(n entries at columns col[]) at the lowest free base
+static int packRow(short *check, int size, int owner, int *col, int *entry, int n, int width)
+{
+    int base, i;
+
+    for (base = 0; ; base++) {
+        if (base + width > size) return -1;
+        for (i = 0; i < n; i++)
+            if (check[base + col[i]] != -1) break;
+        if (i == n) break;
+    }
+    for (i = 0; i < n; i++) {
+        check[base + col[i]] = owner;
+        packedTable[base + col[i]].entry = entry[i];
+    }
+    return base;
+}
+
+// builds the table on the first call, parser() calls it every time.
+// compilations on several threads must call it before they start.
+void initParsingTable()
+{
+    extern int parsingTable[NO_STATES][NO_SYMBOLS + 1];
+    extern int leftSymbol[NO_RULES + 1];
+    static short check[NO_STATES * (NO_SYMBOLS + 1) + NO_STATES];
+    int row[NO_STATES], col[NO_STATES], entry[NO_STATES];
+    int order[NO_STATES + NO_SYMBOLS + 1], count[NO_STATES + NO_SYMBOLS + 1];
+    int state, symbol, noRows, i, j, n, width, size, base, last;
+    int firstNonterminal = NO_SYMBOLS + 1;
+
+    if (packedTable) return;
+    for (i = 1; i <= NO_RULES; i++)
+        if (leftSymbol[i] < firstNonterminal) firstNonterminal = leftSymbol[i];
+
+    size = sizeof(check) / sizeof(check[0]);
+    packedTable = (PackedEntry*)malloc(size * sizeof(PackedEntry));
+    if (!packedTable) {
+        printf("malloc error in initParsingTable()\n");
+        exit(1);
+    }
+    for (i = 0; i < size; i++) check[i] = -1;
+
+    // step 1: default gotos, and the number of entries of every row
+    noRows = 0;
+    for (state = 0; state < NO_STATES; state++) {
+        for (n = 0, symbol = 0; symbol < firstNonterminal; symbol++)
+            if (parsingTable[state][symbol]) n++;
+        order[noRows] = state;
+        count[noRows++] = n;
+    }
+    for (symbol = firstNonterminal; symbol <= NO_SYMBOLS; symbol++) {
+        for (state = 0; state < NO_STATES; state++) row[state] = parsingTable[state][symbol];
+        defaultGoto[symbol] = mostFrequent(row, NO_STATES, 1);
+        for (n = 0, state = 0; state < NO_STATES; state++)
+            if (row[state] && row[state] != defaultGoto[symbol]) n++;
+        order[noRows] = NO_STATES + symbol;
+        count[noRows++] = n;
+    }
+
+    // step 2: pack the rows with the most entries first
+    for (i = 1; i < noRows; i++)
+        for (j = i; j > 0 && count[j - 1] < count[j]; j--) {
+            n = count[j]; count[j] = count[j - 1]; count[j - 1] = n;
+            n = order[j]; order[j] = order[j - 1]; order[j - 1] = n;
+        }
+    last = 0;
+    for (i = 0; i < noRows; i++) {
+        n = 0;
+        if (order[i] < NO_STATES) {             // action row of a state
+            state = order[i];
+            width = firstNonterminal;
+            for (symbol = 0; symbol < firstNonterminal; symbol++)
+                if (parsingTable[state][symbol]) {
+                    col[n] = symbol;
+                    entry[n++] = parsingTable[state][symbol];
+                }
+        }
+        else {                                  // goto column of a nonterminal
+            symbol = order[i] - NO_STATES;
+            width = NO_STATES;
+            for (state = 0; state < NO_STATES; state++)
+                if (parsingTable[state][symbol] && parsingTable[state][symbol] != defaultGoto[symbol]) {
+                    col[n] = state;
+                    entry[n++] = parsingTable[state][symbol];
+                }
+        }
+        base = packRow(check, size, order[i], col, entry, n, width);
+        if (base < 0) {
+            printf("critical compiler error: parsing table does not pack\n");
+            exit(1);
+        }
+        if (order[i] < NO_STATES) actionBase[order[i]] = base;
+        else gotoBase[order[i] - NO_STATES] = base;
+        if (base + width > last) last = base + width;
     }
+    for (i = 0; i < last; i++) packedTable[i].check = check[i];
+    packedTable = (PackedEntry*)realloc(packedTable, last * sizeof(PackedEntry));
+
+    // step 3: every entry of the dense table must come back, and every
+    // error entry of the action part
+    for (state = 0; state < NO_STATES; state++)
+        for (symbol = 0; symbol <= NO_SYMBOLS; symbol++) {
+            n = parsingTable[state][symbol];
+            if (!n && symbol >= firstNonterminal) continue;
+            if ((symbol < firstNonterminal ? ACTION(state, symbol) : GOTO(state, symbol)) != n) {
+                printf("critical compiler error: parsing table packed wrong\n");
+                exit(1);
+            }
+        }
+    initUnitChains();
 }
+#endif
+
+// a unit rule without a node(expression -> assignment_exp, ...) leaves
+// the value stack as it is and only replaces the state on top: in state
+// q over state p it goes to GOTO(p, lhs). after a shift or a goto on
+// symbol X from state p, the whole chain of such reductions for the
+// lookahead t ends in state unitChain[chainRow[p][X] * noTerminals + t]
+// and parser() goes there in one step. row 0 is for the pairs(p, X)
+// that start no chain.
+static short chainRow[NO_STATES][NO_SYMBOLS + 1];
+static short *unitChain;
+static short accessSymbol[NO_STATES];   // the symbol every state is entered on
+static int noTerminals;
 
-Node* parser()
+// end of the chain of unit reductions from state q over state p
+static int chainEnd(int p, int q, int t)
+{
+    extern int leftSymbol[NO_RULES + 1], rightLength[NO_RULES + 1];
+    int entry;
+
+    while ((entry = ACTION(q, t)) < 0 && -entry != GOAL_RULE
+            && rightLength[-entry] == 1 && !ruleName[-entry])
+        q = GOTO(p, leftSymbol[-entry]);
+    return q;
+}
+
+static void initUnitChains()
+{
+    extern int parsingTable[NO_STATES][NO_SYMBOLS + 1];
+    extern int leftSymbol[NO_RULES + 1];
+    int p, symbol, q, t, noRows, chained;
+
+    if (unitChain) return;
+    noTerminals = NO_SYMBOLS + 1;
+    for (t = 1; t <= NO_RULES; t++)
+        if (leftSymbol[t] < noTerminals) noTerminals = leftSymbol[t];
+
+    noRows = 1;
+    for (p = 0; p < NO_STATES; p++)
+        for (symbol = 0; symbol <= NO_SYMBOLS; symbol++) {
+            if ((q = parsingTable[p][symbol]) <= 0) continue;
+            accessSymbol[q] = symbol;
+            for (chained = 0, t = 0; t < noTerminals && !chained; t++)
+                chained = chainEnd(p, q, t) != q;
+            if (chained) chainRow[p][symbol] = noRows++;
+        }
+
+    unitChain = (short*)malloc(noRows * noTerminals * sizeof(short));
+    if (!unitChain) {
+        printf("malloc error in initUnitChains()\n");
+        exit(1);
+    }
+    for (p = 0; p < NO_STATES; p++)
+        for (symbol = 0; symbol <= NO_SYMBOLS; symbol++) {
+            if (!chainRow[p][symbol]) continue;
+            q = parsingTable[p][symbol];
+            for (t = 0; t < noTerminals; t++)
+                unitChain[chainRow[p][symbol] * noTerminals + t] = chainEnd(p, q, t);
+        }
+}
+
+// takes the unit reductions that follow the symbol on top of the stack
+static void skipUnitChain(int lookahead)
+{
+    int row, state;
+
+    row = chainRow[cc->stateStack[cc->sp - 1]][cc->symbolStack[cc->sp]];
+    if (row) {
+        state = unitChain[row * noTerminals + lookahead];
+        cc->stateStack[cc->sp] = state;
+        cc->symbolStack[cc->sp] = accessSymbol[state];
+    }
+}
+
+int parser()
 {
     extern int parsingTable[NO_STATES][NO_SYMBOLS + 1];
     extern int leftSymbol[NO_RULES + 1], rightLength[NO_RULES + 1];
-    int entry, ruleNumber, lhs;
+    int entry, ruleNumber, lhs, tail;
     int currentState;
     struct tokenType token;
-    Node* ptr;
+    int ptr;
     
-    sp = 0; stateStack[sp] = 0; // initial state
-    token = scanner();
+    initParsingTable();
+    if (!cc->stackSize) growStacks();
+    cc->sp = 0; cc->stateStack[cc->sp] = 0; // initial state
+    cc->symbolStack[cc->sp] = 0;
+    token = cc->nextToken();
     while (1) {
-        currentState = stateStack[sp];
-        entry = parsingTable[currentState][token.number];
+        if (cc->sp + 1 >= cc->stackSize) growStacks();
+        currentState = cc->stateStack[cc->sp];
+        entry = ACTION(currentState, token.number);
         if (entry > 0) {                    // shift action
-            sp++;
-            if (sp > PS_SIZE) {
-                printf("critical compiler error: parsing stack overflow");
-                exit(1);
-            }
-            symbolStack[sp] = token.number;
-            stateStack[sp] = entry;
-            valueStack[sp] = meaningfulToken(token) ? buildNode(token) : NULL;
-            token = scanner();
+            cc->sp++;
+            cc->symbolStack[cc->sp] = token.number;
+            cc->stateStack[cc->sp] = entry;
+            cc->valueStack[cc->sp] = meaningfulToken(token) ? buildNode(token) : 0;
+            cc->tailStack[cc->sp] = cc->valueStack[cc->sp];
+            token = cc->nextToken();
+            skipUnitChain(token.number);
         }
         else if (entry < 0) {               // reduce action
             ruleNumber = -entry;
@@ -281,26 +707,29 @@ Node* parser()
                 /*if (errcnt == 0) printf(" *** valid source ***\n");
                 else printf(" *** error in source : %d\n", errcnt);
                 return;*/
-                return valueStack[sp-1];
+                return cc->valueStack[cc->sp-1];
             }
             //semantic(ruleNumber);
-            ptr = buildTree(ruleName[ruleNumber], rightLength[ruleNumber]);
-            sp = sp - rightLength[ruleNumber];
+            ptr = buildTree(ruleName[ruleNumber], rightLength[ruleNumber], &tail);
+            cc->sp = cc->sp - rightLength[ruleNumber];
             lhs = leftSymbol[ruleNumber];
-            currentState = parsingTable[stateStack[sp]][lhs];
-            sp++;
-            symbolStack[sp] = lhs;
-            stateStack[sp] = currentState;
-            valueStack[sp] = ptr;
+            currentState = GOTO(cc->stateStack[cc->sp], lhs);
+            cc->sp++;
+            cc->symbolStack[cc->sp] = lhs;
+            cc->stateStack[cc->sp] = currentState;
+            cc->valueStack[cc->sp] = ptr;
+            cc->tailStack[cc->sp] = tail;
+            skipUnitChain(token.number);
         }
         else {                              // error action
+            cc->errcnt++;
+            if (quietErrors) return 0;
             printf(" === error in source ===\n");
-            //errcnt++;
             printf("Current Token : ");
             printToken(token);
             dumpStack();
-            errorRecovery();
-            token = scanner();
+            if (!errorRecovery()) return 0;
+            token = cc->nextToken();
         }
     } // while
 } // parser
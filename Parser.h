@@ -3,15 +3,72 @@
 //#define GOAL_RULE (NO_RULES+1)  // accept rule
 //#define NO_SYMBOLS 85           // number of grammar symbols
 //#define NO_STATES 153           // number of states
-#define PS_SIZE 200             // size of parsing stack
+#define PS_SIZE 200             // initial size of parsing stack
  
+enum {terminal, nonterm};
+
+// the AST is one array of nodes, a tree refers to its nodes by index.
+// index 0 is never used so that 0 stands for no node.
 typedef struct nodeType {
-    struct tokenType token;
-    enum {terminal, nonterm} noderep;
-    struct nodeType* son;
-    struct nodeType* brother;
+    short number;       // token number of a terminal, node number otherwise
+    short noderep;      // terminal or nonterm
+    int value;          // identifier id or number of a terminal
+    int son;            // first son
+    int brother;        // next brother
 } Node;
 
+#define KIND(n)     (cc->nodes[n].number)
+#define NODEREP(n)  (cc->nodes[n].noderep)
+#define VALUE(n)    (cc->nodes[n].value)
+#define SON(n)      (cc->nodes[n].son)
+#define BROTHER(n)  (cc->nodes[n].brother)
+
+// everything one compilation changes. each thread compiles through its
+// own cc, so several sources can be compiled at the same time.
+typedef struct compilation {
+    // parser
+    struct tokenType (*nextToken)();    // token source of parser()
+    int errcnt;
+    int sp;                     // stack pointer
+    int stackSize;
+    int *stateStack;            // state stack
+    int *symbolStack;           // symbol stack
+    int *valueStack;            // value stack
+    int *tailStack;             // last brother of each value
+    Node *nodes;
+    long nodeCount;             // nodes in use, nodes[0] excluded
+    long nodeSize;              // nodes allocated
+    long nodeGrowths;           // number of reallocations
+
+    // intermediate code generator
+    FILE *astFile;
+    FILE *ucodeFile;
+    int base, offset, width;
+    int lvalue, rvalue;
+    struct tableType *symbolTable;
+    int stTop, stSize;
+    int symLevel;
+    int *visible;               // identifier id -> innermost entry + 1
+    int visibleSize;
+    int *scopes;                // marks of the open scopes
+    int noScopes, scopesSize;
+    int labelNum;
+    struct instruction *code;   // code buffer, written out by writeCode()
+    int codeCount, codeSize;
+    struct reduction *reductions;   // address temporaries of the open loops
+    int noReductions, reductionsSize;
+    struct address *addresses;  // common addresses of the open blocks
+    int noAddresses, addressesSize;
+    int frameTop;               // highest frame offset in use + 1
+    int inlining, returnLabel;  // a return jumps to returnLabel when inlining
+} Compilation;
+
+extern THREAD_LOCAL Compilation *cc;
+
+Compilation *newCompilation();
+void freeCompilation(Compilation *c);
+void growStacks();
+
 enum nodeNumber {
     ACTUAL_PARAM,   ADD,            ADD_ASSIGN,     ARRAY_VAR,      ASSIGN_OP,
     CALL,           COMPOUND_ST,    CONST_NODE,     DCL,            DCL_ITEM,
@@ -33,17 +90,24 @@ extern char *tokenName[];
 void semantic(int);
 void printToken(struct tokenType token);
 void dumpStack();
-void errorRecovery();
+int errorRecovery();
 int meaningfulToken(struct tokenType token);
-Node* buildNode(struct tokenType token);
-Node* buildTree(int nodeNumber, int rhsLength);
-void printNode(Node *pt, int indent);
-void printTree(Node *pt, int indent);
- 
-extern int errcnt;
-extern int sp;                      // stack pointer
-extern int stateStack[PS_SIZE];     // state stack
-extern int symbolStack[PS_SIZE];    // symbol stack
-extern Node* valueStack[PS_SIZE];     // value stack
+void reserveNodes(long n);
+int newNode();
+void freeNodes();
+void nodeStatistics(FILE *fp);
+int buildNode(struct tokenType token);
+int buildTree(int nodeNumber, int rhsLength, int *tail);
+void printNode(int pt, int indent);
+void printTree(int pt, int indent);
+
+// binary AST file, see saveTree() in Parser.c
+#define AST_MAGIC   0x5453414d  // "MAST"
+#define AST_VERSION 1
+int saveTree(FILE *fp, int root);
+int loadTree(FILE *fp);
  
-Node *parser();
+void initParsingTable();
+int parser();
+int directParser();         // DirectParser.c, generated by DirectGen
+int splitParser(int noThreads);     // SplitParser.c
@@ -1,4 +1,23 @@
 #include "Scanner.h"
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SCAN_SIMD
+#include <immintrin.h>
+#endif
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <pthread.h>
+#endif
+
+#define READ_BLOCK 65536   // block size when the source cannot be mapped
+#define NAME_POOL 65536    // chunk size of the identifier string pool
+
+// the source is scanned through a pointer over the whole text,
+// EOF is reported once cp reaches sourceEnd.
+#define nextChar()  (cp < sourceEnd ? (unsigned char)*cp++ : EOF)
+#define retract(ch) do { if ((ch) != EOF) cp--; } while (0)
 
 char *keyword[NO_KEYWORDS] = {
     "const", "else", "if", "int", "return", "void", "while"
@@ -8,6 +27,475 @@ enum tsymbol tnum[NO_KEYWORDS] = {
     tconst, telse, tif, tint, treturn, tvoid, twhile
 };
 
+THREAD_LOCAL char *sourceBuffer = NULL;
+THREAD_LOCAL char *sourceEnd = NULL;
+THREAD_LOCAL char *cp = NULL;
+THREAD_LOCAL char *tokenStart = NULL;
+THREAD_LOCAL int quietErrors = 0;
+THREAD_LOCAL int lexicalErrors = 0;
+static THREAD_LOCAL long sourceLength;
+static THREAD_LOCAL int sourceMapped;
+
+static void initScannerOnce();
+
+void setSource(char *text, long length)
+{
+    initScannerOnce();
+    sourceBuffer = cp = text;
+    sourceEnd = text + length;
+    sourceLength = length;
+    sourceMapped = 0;
+}
+
+// map the source file into memory, or read it in large blocks when
+// it can not be mapped(empty file, pipe, no mmap). returns 0 on failure.
+int openSource(char *fileName)
+{
+    FILE *fp;
+    char *text;
+    long size, capacity;
+    size_t n;
+
+#ifndef _WIN32
+    int fd;
+    struct stat st;
+
+    if ((fd = open(fileName, O_RDONLY)) < 0) return 0;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+        text = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (text != MAP_FAILED) {
+            madvise(text, st.st_size, MADV_SEQUENTIAL);
+            close(fd);
+            setSource(text, st.st_size);
+            sourceMapped = 1;
+            return 1;
+        }
+    }
+    close(fd);
+#endif
+
+    if ((fp = fopen(fileName, "rb")) == NULL) return 0;
+    size = 0;
+    capacity = READ_BLOCK;
+    text = (char*)malloc(capacity);
+    if (!text) {
+        printf("malloc error in openSource()\n");
+        exit(1);
+    }
+    while ((n = fread(text + size, 1, capacity - size, fp)) > 0) {
+        size += n;
+        if (size == capacity) {
+            capacity *= 2;
+            text = (char*)realloc(text, capacity);
+            if (!text) {
+                printf("realloc error in openSource()\n");
+                exit(1);
+            }
+        }
+    }
+    fclose(fp);
+    setSource(text, size);
+    return 1;
+}
+
+void closeSource()
+{
+    if (!sourceBuffer) return;
+#ifndef _WIN32
+    if (sourceMapped) munmap(sourceBuffer, sourceLength);
+    else
+#endif
+    free(sourceBuffer);
+    sourceBuffer = sourceEnd = cp = NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////// name table
+// every identifier is hashed once by the scanner and later stages
+// compare the returned ids. open addressing, kept at most half full.
+// the table is shared by all compilations, so ids are the same in every
+// thread; intern() and idName() hold nameLock.
+struct nameEntry {
+    char *name;
+    int length;
+    unsigned int hash;
+};
+
+static struct nameEntry *names;     // indexed by id
+static int noNames, namesSize;
+static int *nameHash;               // hash slot -> id + 1, 0 if empty
+static unsigned int hashSize;
+static char *namePool;
+static int namePoolLeft;
+
+#ifndef _WIN32
+static pthread_mutex_t nameLock = PTHREAD_MUTEX_INITIALIZER;
+#define lockNames()     pthread_mutex_lock(&nameLock)
+#define unlockNames()   pthread_mutex_unlock(&nameLock)
+#else
+#define lockNames()
+#define unlockNames()
+#endif
+
+static unsigned int hashName(char *text, int length)
+{
+    unsigned int h = 2166136261u;   // FNV-1a
+    while (length-- > 0)
+        h = (h ^ (unsigned char)*text++) * 16777619u;
+    return h;
+}
+
+static void rehashNames()
+{
+    int i;
+    unsigned int slot;
+
+    free(nameHash);
+    hashSize = hashSize ? hashSize * 2 : 1024;
+    nameHash = (int*)calloc(hashSize, sizeof(int));
+    if (!nameHash) {
+        printf("calloc error in rehashNames()\n");
+        exit(1);
+    }
+    for (i = 0; i < noNames; i++) {
+        slot = names[i].hash & (hashSize - 1);
+        while (nameHash[slot]) slot = (slot + 1) & (hashSize - 1);
+        nameHash[slot] = i + 1;
+    }
+}
+
+static char *saveName(char *text, int length)
+{
+    char *s;
+
+    if (length + 1 > namePoolLeft) {
+        namePoolLeft = length + 1 > NAME_POOL ? length + 1 : NAME_POOL;
+        namePool = (char*)malloc(namePoolLeft);
+        if (!namePool) {
+            printf("malloc error in saveName()\n");
+            exit(1);
+        }
+    }
+    s = namePool;
+    memcpy(s, text, length);
+    s[length] = '\0';
+    namePool += length + 1;
+    namePoolLeft -= length + 1;
+    return s;
+}
+
+static int enterName(char *text, int length, unsigned int h)
+{
+    unsigned int slot;
+    int id;
+
+    slot = h & (hashSize - 1);
+    while ((id = nameHash[slot]) != 0) {
+        id--;
+        if (names[id].hash == h && names[id].length == length
+                && !memcmp(names[id].name, text, length))
+            return id;
+        slot = (slot + 1) & (hashSize - 1);
+    }
+
+    // not found, enter a new name
+    if (noNames == namesSize) {
+        namesSize = namesSize ? namesSize * 2 : 512;
+        names = (struct nameEntry*)realloc(names, namesSize * sizeof(struct nameEntry));
+        if (!names) {
+            printf("realloc error in enterName()\n");
+            exit(1);
+        }
+    }
+    id = noNames++;
+    names[id].name = saveName(text, length);
+    names[id].length = length;
+    names[id].hash = h;
+    nameHash[slot] = id + 1;
+    if ((unsigned int)noNames * 2 > hashSize) rehashNames();
+    return id;
+}
+
+static void initNames()
+{
+    int i;
+
+    rehashNames();
+    for (i = 0; i < NO_KEYWORDS; i++)
+        enterName(keyword[i], strlen(keyword[i]), hashName(keyword[i], strlen(keyword[i])));
+    enterName("read", 4, hashName("read", 4));      // ID_READ
+    enterName("write", 5, hashName("write", 5));    // ID_WRITE
+    enterName("lf", 2, hashName("lf", 2));          // ID_LF
+}
+
+// every thread remembers the names it has interned lately, so threads
+// scanning at the same time take nameLock only for names new to them.
+// the saved names never move and ids never change, a hit needs no lock.
+#define NAME_CACHE 1024
+
+static THREAD_LOCAL struct nameEntry nameCache[NAME_CACHE];
+static THREAD_LOCAL int nameCacheId[NAME_CACHE];
+
+int intern(char *text, int length)
+{
+    struct nameEntry *e;
+    unsigned int h;
+    int id;
+
+    h = hashName(text, length);
+    e = &nameCache[h & (NAME_CACHE - 1)];
+    if (e->name && e->hash == h && e->length == length && !memcmp(e->name, text, length))
+        return nameCacheId[h & (NAME_CACHE - 1)];
+
+    lockNames();
+    if (!nameHash) initNames();
+    id = enterName(text, length, h);
+    e->name = names[id].name;
+    unlockNames();
+    e->length = length;
+    e->hash = h;
+    nameCacheId[h & (NAME_CACHE - 1)] = id;
+    return id;
+}
+
+char *idName(int id)
+{
+    char *name;
+
+    lockNames();
+    name = names[id].name;
+    unlockNames();
+    return name;
+}
+
+//////////////////////////////////////////////////////////////////////////// character runs
+// blanks, comment bodies and identifier/number runs are skipped 16 or 32
+// bytes at a time. each routine returns the first position in [p, end)
+// that does not belong to the run, or end. the vector loops never read
+// past end, the tail is finished by the scalar code.
+static int blank[256], identChar[256], digitChar[256];
+
+static char *skipBlanksScalar(char *p, char *end)
+{
+    while (p < end && blank[(unsigned char)*p]) p++;
+    return p;
+}
+
+static char *skipIdentScalar(char *p, char *end)
+{
+    while (p < end && identChar[(unsigned char)*p]) p++;
+    return p;
+}
+
+static char *skipDigitsScalar(char *p, char *end)
+{
+    while (p < end && digitChar[(unsigned char)*p]) p++;
+    return p;
+}
+
+static char *findCharScalar(char *p, char *end, int c)
+{
+    while (p < end && *p != c) p++;
+    return p;
+}
+
+#ifdef SCAN_SIMD
+// x <= hi (unsigned), per byte
+#define LE_SSE2(x, hi)  _mm_cmpeq_epi8(_mm_min_epu8((x), (hi)), (x))
+#define LE_AVX2(x, hi)  _mm256_cmpeq_epi8(_mm256_min_epu8((x), (hi)), (x))
+
+__attribute__((target("sse2")))
+static char *skipBlanksSSE2(char *p, char *end)
+{
+    __m128i x, m;
+    unsigned int mask;
+
+    for (; end - p >= 16; p += 16) {
+        x = _mm_loadu_si128((__m128i*)p);
+        // ' ' or '\t' .. '\r'
+        m = _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(' ')),
+                LE_SSE2(_mm_sub_epi8(x, _mm_set1_epi8('\t')), _mm_set1_epi8(4)));
+        mask = ~_mm_movemask_epi8(m) & 0xFFFF;
+        if (mask) return p + __builtin_ctz(mask);
+    }
+    return skipBlanksScalar(p, end);
+}
+
+__attribute__((target("sse2")))
+static char *skipIdentSSE2(char *p, char *end)
+{
+    __m128i x, m;
+    unsigned int mask;
+
+    for (; end - p >= 16; p += 16) {
+        x = _mm_loadu_si128((__m128i*)p);
+        // '0'..'9', 'a'..'z' or 'A'..'Z', '_'
+        m = _mm_or_si128(LE_SSE2(_mm_sub_epi8(x, _mm_set1_epi8('0')), _mm_set1_epi8(9)),
+                LE_SSE2(_mm_sub_epi8(_mm_or_si128(x, _mm_set1_epi8(0x20)), _mm_set1_epi8('a')),
+                    _mm_set1_epi8(25)));
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(x, _mm_set1_epi8('_')));
+        mask = ~_mm_movemask_epi8(m) & 0xFFFF;
+        if (mask) return p + __builtin_ctz(mask);
+    }
+    return skipIdentScalar(p, end);
+}
+
+__attribute__((target("sse2")))
+static char *skipDigitsSSE2(char *p, char *end)
+{
+    __m128i x;
+    unsigned int mask;
+
+    for (; end - p >= 16; p += 16) {
+        x = _mm_loadu_si128((__m128i*)p);
+        x = _mm_sub_epi8(x, _mm_set1_epi8('0'));
+        mask = ~_mm_movemask_epi8(LE_SSE2(x, _mm_set1_epi8(9))) & 0xFFFF;
+        if (mask) return p + __builtin_ctz(mask);
+    }
+    return skipDigitsScalar(p, end);
+}
+
+__attribute__((target("sse2")))
+static char *findCharSSE2(char *p, char *end, int c)
+{
+    __m128i x;
+    unsigned int mask;
+
+    for (; end - p >= 16; p += 16) {
+        x = _mm_loadu_si128((__m128i*)p);
+        mask = _mm_movemask_epi8(_mm_cmpeq_epi8(x, _mm_set1_epi8(c)));
+        if (mask) return p + __builtin_ctz(mask);
+    }
+    return findCharScalar(p, end, c);
+}
+
+__attribute__((target("avx2")))
+static char *skipBlanksAVX2(char *p, char *end)
+{
+    __m256i x, m;
+    unsigned int mask;
+
+    for (; end - p >= 32; p += 32) {
+        x = _mm256_loadu_si256((__m256i*)p);
+        m = _mm256_or_si256(_mm256_cmpeq_epi8(x, _mm256_set1_epi8(' ')),
+                LE_AVX2(_mm256_sub_epi8(x, _mm256_set1_epi8('\t')), _mm256_set1_epi8(4)));
+        mask = ~(unsigned int)_mm256_movemask_epi8(m);
+        if (mask) return p + __builtin_ctz(mask);
+    }
+    return skipBlanksSSE2(p, end);
+}
+
+__attribute__((target("avx2")))
+static char *skipIdentAVX2(char *p, char *end)
+{
+    __m256i x, m;
+    unsigned int mask;
+
+    for (; end - p >= 32; p += 32) {
+        x = _mm256_loadu_si256((__m256i*)p);
+        m = _mm256_or_si256(LE_AVX2(_mm256_sub_epi8(x, _mm256_set1_epi8('0')), _mm256_set1_epi8(9)),
+                LE_AVX2(_mm256_sub_epi8(_mm256_or_si256(x, _mm256_set1_epi8(0x20)),
+                    _mm256_set1_epi8('a')), _mm256_set1_epi8(25)));
+        m = _mm256_or_si256(m, _mm256_cmpeq_epi8(x, _mm256_set1_epi8('_')));
+        mask = ~(unsigned int)_mm256_movemask_epi8(m);
+        if (mask) return p + __builtin_ctz(mask);
+    }
+    return skipIdentSSE2(p, end);
+}
+
+__attribute__((target("avx2")))
+static char *skipDigitsAVX2(char *p, char *end)
+{
+    __m256i x;
+    unsigned int mask;
+
+    for (; end - p >= 32; p += 32) {
+        x = _mm256_loadu_si256((__m256i*)p);
+        x = _mm256_sub_epi8(x, _mm256_set1_epi8('0'));
+        mask = ~(unsigned int)_mm256_movemask_epi8(LE_AVX2(x, _mm256_set1_epi8(9)));
+        if (mask) return p + __builtin_ctz(mask);
+    }
+    return skipDigitsSSE2(p, end);
+}
+
+__attribute__((target("avx2")))
+static char *findCharAVX2(char *p, char *end, int c)
+{
+    __m256i x;
+    unsigned int mask;
+
+    for (; end - p >= 32; p += 32) {
+        x = _mm256_loadu_si256((__m256i*)p);
+        mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(x, _mm256_set1_epi8(c)));
+        if (mask) return p + __builtin_ctz(mask);
+    }
+    return findCharSSE2(p, end, c);
+}
+#endif
+
+static char *(*skipBlanks)(char *p, char *end);
+static char *(*skipIdent)(char *p, char *end);
+static char *(*skipDigits)(char *p, char *end);
+static char *(*findChar)(char *p, char *end, int c);
+char *scanModeName[] = { "scalar", "sse2", "avx2" };
+
+// select the character run routines. an unsupported mode falls back to
+// the best one below it; returns the mode in use.
+static int selectRuns(int mode)
+{
+#ifdef SCAN_SIMD
+    __builtin_cpu_init();
+    if (mode >= SCAN_AVX2 && __builtin_cpu_supports("avx2")) {
+        skipBlanks = skipBlanksAVX2; skipIdent = skipIdentAVX2;
+        skipDigits = skipDigitsAVX2; findChar = findCharAVX2;
+        return SCAN_AVX2;
+    }
+    if (mode >= SCAN_SSE2 && __builtin_cpu_supports("sse2")) {
+        skipBlanks = skipBlanksSSE2; skipIdent = skipIdentSSE2;
+        skipDigits = skipDigitsSSE2; findChar = findCharSSE2;
+        return SCAN_SSE2;
+    }
+#endif
+    skipBlanks = skipBlanksScalar; skipIdent = skipIdentScalar;
+    skipDigits = skipDigitsScalar; findChar = findCharScalar;
+    return SCAN_SCALAR;
+}
+
+// the character classes and the best mode the cpu supports are set up
+// once, by the first setSource() of any thread
+static void initScanner()
+{
+    int i;
+
+    for (i = 0; i < 256; i++) {
+        blank[i] = isspace(i) != 0;
+        identChar[i] = isalnum(i) || i == '_';
+        digitChar[i] = isdigit(i) != 0;
+    }
+    selectRuns(SCAN_AVX2);
+}
+
+#ifndef _WIN32
+static pthread_once_t scannerOnce = PTHREAD_ONCE_INIT;
+static void initScannerOnce() { pthread_once(&scannerOnce, initScanner); }
+#else
+static void initScannerOnce()
+{
+    static int done;
+    if (!done) {
+        initScanner();
+        done = 1;
+    }
+}
+#endif
+
+// another mode for measurements(see ScanBench), call it before the
+// threads start scanning
+int setScanMode(int mode)
+{
+    initScannerOnce();
+    return selectRuns(mode);
+}
+
 int hexValue(char ch)
 {
     switch (ch) {
@@ -27,60 +515,63 @@ int hexValue(char ch)
 
 void lexicalError(int n)
 {
+    lexicalErrors++;
+    if (quietErrors) return;
     printf(" *** Lexical Error : ");
     switch (n)
     {
-    case 1: printf("an identifier length must be less than 12.\n");
-        break;
     case 2: printf("next character must be &.\n");
         break;
     case 3: printf("next character must be |.\n");
         break;
     case 4: printf("invalid character!!!\n");
         break;
+    case 5: printf("comment is not closed before the end of source.\n");
+        break;
     }
 }
 
-int getIntNum(char firstCharacter)
+int getIntNum(int firstCharacter)
 {
     int num = 0;
     int value;
-    char ch;
+    int ch;
+    char *end;
 
     if (firstCharacter != '0') {
-        ch = firstCharacter;
-        do {
-            num = 10 * num + (int)(ch - '0');
-            ch = getchar();
-        } while (isdigit(ch));
+        num = firstCharacter - '0';
+        end = skipDigits(cp, sourceEnd);
+        while (cp < end)
+            num = 10 * num + (*cp++ - '0');
+        return num;
     }
     else {
-        ch = getchar(); 
+        ch = nextChar(); 
         if ((ch >= '0') && (ch <= '7')) {   // octal
             do {
                 num = 8 * num + (int)(ch - '0');
-                ch = getchar();
+                ch = nextChar();
             } while ((ch >= '0') && (ch <= '7'));
         }
         else if ((ch == 'X') || (ch == 'x')) {  // hexa decimal
-            while ((value = hexValue(ch = getchar())) != -1)
+            while ((value = hexValue(ch = nextChar())) != -1)
                 num = 16 * num + value;
         }
         else {  // zero
             num = 0;
         }
     }
-    ungetc(ch, stdin); /* retract */
+    retract(ch);
     return num;
 }
 
-int superLetter(char ch)
+int superLetter(int ch)
 {
     if (isalpha(ch) || ch == '_') return 1;
     else return 0;
 }
 
-int superLetterOrDigit(char ch)
+int superLetterOrDigit(int ch)
 {
     if (isalnum(ch) || ch == '_') return 1;
     else return 0;
@@ -89,41 +580,34 @@ int superLetterOrDigit(char ch)
 struct tokenType scanner()
 {
     struct tokenType token;
-    int i, index;
-    char ch, id[ID_LENGTH];
+    char *start;
+    int id;
+    int ch;
     
     token.number = tnull;
 
     do {
-        while (isspace(ch = getchar())); // state 1: skip blanks
+        cp = skipBlanks(cp, sourceEnd);     // state 1: skip blanks
+        tokenStart = cp;
+        ch = nextChar();
 
         // identifier or keyword
         if (superLetter(ch)) {
-            i = 0;
+            start = cp - 1;
 
-            // 영문자, 숫자, _를 한 글자씩 읽어서 id를 구성.
-            do {
-                if (i < ID_LENGTH) id[i++] = ch;
-                ch = getchar();
-            } while (superLetterOrDigit(ch));
-            if (i >= ID_LENGTH) {
-                lexicalError(1);
-                i = 0;
-            }
-            id[i] = '\0';
-            ungetc(ch, stdin); // retract
+            // 영문자, 숫자, _의 끝까지 한번에 건너뛴다.
+            cp = skipIdent(cp, sourceEnd);
 
-            // find the identifier in the keyword table
-            for (index = 0; index < NO_KEYWORDS; index++)
-                if (!strcmp(id, keyword[index])) break;
+            // keywords are pre-seeded in the name table
+            id = intern(start, cp - start);
             
-            if (index < NO_KEYWORDS) {   // found, keyword exit
-                token.number = tnum[index];
+            if (id < NO_KEYWORDS) {   // found, keyword exit
+                token.number = tnum[id];
             }
 
             else {  // not found, identifier exit
                 token.number = tident;
-                strcpy(token.value.id, id);
+                token.value.id = id;
             }
         } // end of identifier(token.number) or keyword(token.value.id)
 
@@ -136,84 +620,92 @@ struct tokenType scanner()
         // special character
         else switch (ch) {
         case '/': // state 10
-            ch = getchar();
+            ch = nextChar();
             if (ch == '*') {
-                ch = getchar();
+                ch = nextChar();
                 if (ch != '*') {    // text comment
                     do {
-                        while (ch != '*') ch = getchar();
-                        ch = getchar();
-                    } while (ch != '/');
+                        if (ch != '*') {
+                            cp = findChar(cp, sourceEnd, '*');
+                            ch = nextChar();
+                        }
+                        ch = nextChar();
+                    } while (ch != '/' && ch != EOF);
+                    if (ch == EOF) lexicalError(5);
                 }
                 else {  // /**
-                    ch = getchar();
+                    ch = nextChar();
                     if (ch == '/'); // text comment
                     else {          // document comment
                         do {
-                            while (ch != '*') ch = getchar();
-                            ch = getchar();
-                        } while (ch != '/');
-                        printf(" document comment!\n");
+                            if (ch != '*') {
+                                cp = findChar(cp, sourceEnd, '*');
+                                ch = nextChar();
+                            }
+                            ch = nextChar();
+                        } while (ch != '/' && ch != EOF);
+                        if (ch == EOF) lexicalError(5);
+                        else printf(" document comment!\n");
                     }
                 }
             }
             else if (ch == '/') // line comment
-                while (getchar() != '\n');
+                cp = findChar(cp, sourceEnd, '\n');
             else if (ch == '=') {
                 token.number = tdivAssign;
             }
             else {
                 token.number = tdiv;
-                ungetc(ch, stdin); // retract
+                retract(ch); // retract
             }
             break;
 
         case '!':   // state 17
-            ch = getchar();
+            ch = nextChar();
             if (ch == '=') {
                 token.number = tnotequ;
             }
             else {
                 token.number = tnot;
-                ungetc(ch, stdin); // retract
+                retract(ch); // retract
             }
             break;
 
         case '%':   // state 20
-            ch = getchar();
+            ch = nextChar();
             if (ch == '=') {
                 token.number = tmodAssign;
             }
             else {
                 token.number = tmod;
-                ungetc(ch, stdin);
+                retract(ch);
             }
             break;
 
         case '&': // state 23
-            ch = getchar();
+            ch = nextChar();
             if (ch == '&') {
                 token.number = tand;
             }
             else {
                 lexicalError(2);
-                ungetc(ch, stdin); // retract
+                retract(ch); // retract
             }
             break;
 
         case '*': // state 25
-            ch = getchar();
+            ch = nextChar();
             if (ch == '=') {
                 token.number = tmulAssign;
             }
             else {
                 token.number = tmul;
-                ungetc(ch, stdin);   // retract
+                retract(ch);   // retract
             }
             break;
 
         case '+': // state 28
-            ch = getchar();
+            ch = nextChar();
             if (ch == '+') {
                 token.number = tinc;
             }
@@ -222,12 +714,12 @@ struct tokenType scanner()
             }
             else {
                 token.number = tplus;
-                ungetc(ch, stdin);   // retract
+                retract(ch);   // retract
             }
             break;
 
         case '-':   // state 32
-            ch = getchar();
+            ch = nextChar();
             if (ch == '-') {
                 token.number = tdec;
             }
@@ -236,51 +728,51 @@ struct tokenType scanner()
             }
             else {
                 token.number = tminus;
-                ungetc(ch, stdin);   // retract
+                retract(ch);   // retract
             }
             break;
 
         case '<':   // state 36
-            ch = getchar();
+            ch = nextChar();
             if (ch == '=') {
                 token.number = tlesse;
             }
             else {
                 token.number = tless;
-                ungetc(ch, stdin);   // retract
+                retract(ch);   // retract
             }
             break;
 
         case '=':   // state 39
-            ch = getchar();
+            ch = nextChar();
             if (ch == '=') {
                 token.number = tequal;
             }
             else {
                 token.number = tassign;
-                ungetc(ch, stdin);   // retract
+                retract(ch);   // retract
             }
             break;
 
         case '>':   //state 42
-            ch = getchar();
+            ch = nextChar();
             if (ch == '=') {
                 token.number = tgreate;
             }
             else {
                 token.number = tgreat;
-                ungetc(ch, stdin);   // retract
+                retract(ch);   // retract
             }
             break;
 
         case '|':   // state 45
-            ch = getchar();
+            ch = nextChar();
             if (ch == '|') {
                 token.number = tor;
             }
             else {
                 lexicalError(3);
-                ungetc(ch, stdin);   // retract
+                retract(ch);   // retract
             }
             break;
 
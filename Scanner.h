@@ -4,7 +4,19 @@
 #include <ctype.h>
 
 #define NO_KEYWORDS 7
-#define ID_LENGTH 12
+
+// state of a compilation is kept per thread
+#ifdef _MSC_VER
+#define THREAD_LOCAL __declspec(thread)
+#else
+#define THREAD_LOCAL __thread
+#endif
+
+// identifiers are interned: the keywords get ids 0..NO_KEYWORDS-1 in the
+// order of keyword[], followed by the predefined procedures.
+#define ID_READ     (NO_KEYWORDS)
+#define ID_WRITE    (NO_KEYWORDS + 1)
+#define ID_LF       (NO_KEYWORDS + 2)
 
 enum tsymbol {
     tnull = -1, 
@@ -28,18 +40,40 @@ enum tsymbol {
 struct tokenType {
     int number; // token number
     union {
-        char id[ID_LENGTH];         // identifier
+        int id;                     // identifier(interned id)
         int num;                    // number
     } value;    // token value
 };
 
+enum scanMode { SCAN_SCALAR, SCAN_SSE2, SCAN_AVX2 };
+
 extern char *keyword[NO_KEYWORDS];
 extern enum tsymbol tnum[NO_KEYWORDS];
 
+extern THREAD_LOCAL char *sourceBuffer;    // source text (mapped or loaded)
+extern THREAD_LOCAL char *sourceEnd;       // one past the last character
+extern THREAD_LOCAL char *cp;              // current scan position
+extern THREAD_LOCAL char *tokenStart;      // first character of the last token
+
+// errors are counted per thread. with quietErrors set the scanner and
+// the parsers report nothing and the parsers give up at the first error.
+extern THREAD_LOCAL int quietErrors;
+extern THREAD_LOCAL int lexicalErrors;
+
+int openSource(char *fileName);
+void setSource(char *text, long length);
+void closeSource();
+
+extern char *scanModeName[];
+int setScanMode(int mode);
+
+int intern(char *text, int length);
+char *idName(int id);
+
 int hexValue(char ch);
 void lexicalError(int n);
-int getIntNum(char firstCharacter);
-int superLetter(char ch);
-int superLetterOrDigit(char ch);
+int getIntNum(int firstCharacter);
+int superLetter(int ch);
+int superLetterOrDigit(int ch);
 
 struct tokenType scanner();
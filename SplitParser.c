@@ -0,0 +1,217 @@
+/*
+ * Parallel front end
+ *
+ * the source is cut into parts at top-level declarations: a ';' at brace
+ * depth zero or the '}' that brings the depth back to zero ends one. the
+ * parts are scanned and parsed by directParser() on a pool of threads,
+ * each into the node array of its own compilation, and the arrays are
+ * appended to the node array of the current compilation(cc) in source
+ * order under one PROGRAM node. a parse on one thread creates the nodes
+ * of a declaration before any node of the next one and PROGRAM last, so
+ * the spliced tree has the same nodes at the same indices.
+ * the parts are parsed with quietErrors set. when one of them has an
+ * error the whole source is parsed again on the calling thread, so the
+ * error messages and the error recovery are those of directParser().
+ */
+#include "Parser.h"
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+#define PARTS_PER_THREAD 4      // parts per thread, for load balance
+#define MIN_PART 65536          // smallest part in bytes
+
+typedef struct {
+    char *text;
+    long length;
+    Compilation *c;             // compilation that holds its nodes
+    int root;                   // its PROGRAM node, 0 after an error
+} Part;
+
+// last character of the comment that starts at p
+static char *commentEnd(char *p, char *end)
+{
+    char *q;
+
+    if (p[1] == '/') {                          // line comment
+        q = (char*)memchr(p, '\n', end - p);
+        return q ? q : end - 1;
+    }
+    for (q = p + 2; q + 1 < end; q++)           // text comment
+        if (q[0] == '*' && q[1] == '/') return q + 1;
+    return end - 1;
+}
+
+// cut [text, end) into parts of about partSize bytes. returns their
+// number, or 0 if the source has a document comment(the scanner prints
+// a message for each one, that would come from several threads).
+static int cutParts(char *text, char *end, long partSize, Part *parts, int maxParts)
+{
+    char *p, *start, *lastEnd;
+    int depth, n;
+
+    n = depth = 0;
+    start = lastEnd = text;
+    for (p = text; p < end; p++) {
+        switch (*p) {
+        case '{':
+            depth++;
+            continue;
+        case '}':
+            if (--depth) continue;
+            break;
+        case ';':
+            if (depth) continue;
+            break;
+        case '/':
+            if (p + 1 == end || (p[1] != '/' && p[1] != '*')) continue;
+            if (p[1] == '*' && p + 2 < end && p[2] == '*' && (p + 3 == end || p[3] != '/'))
+                return 0;                               // document comment
+            p = commentEnd(p, end);
+            continue;
+        default:
+            continue;
+        }
+
+        // end of a top-level declaration
+        lastEnd = p + 1;
+        if (lastEnd - start >= partSize && n < maxParts - 1) {
+            parts[n].text = start;
+            parts[n++].length = lastEnd - start;
+            start = lastEnd;
+        }
+    }
+
+    // the rest goes to the last part, which must contain a declaration
+    if (lastEnd > start || n == 0) {
+        parts[n].text = start;
+        parts[n++].length = end - start;
+    }
+    else parts[n - 1].length = end - parts[n - 1].text;
+    return n;
+}
+
+static void parsePart(Part *part)
+{
+    cc = newCompilation();
+    setSource(part->text, part->length);
+    quietErrors = 1;
+    lexicalErrors = 0;
+    part->root = directParser();
+    if (cc->errcnt || lexicalErrors || part->root != cc->nodeCount) part->root = 0;
+    part->c = cc;
+    cc = NULL;
+}
+
+#ifndef _WIN32
+// the parts of one source, taken in order by its threads
+typedef struct {
+    Part *parts;
+    int noParts, nextPart;
+    pthread_mutex_t lock;
+} PartQueue;
+
+static void *partWorker(void *arg)
+{
+    PartQueue *q = (PartQueue*)arg;
+    int i;
+
+    while (1) {
+        pthread_mutex_lock(&q->lock);
+        i = q->nextPart++;
+        pthread_mutex_unlock(&q->lock);
+        if (i >= q->noParts) break;
+        parsePart(&q->parts[i]);
+    }
+    return NULL;
+}
+#endif
+
+// append the nodes of the parts to cc and link their declarations
+static int spliceParts(Part *parts, int noParts)
+{
+    Node *from, *to;
+    long total, base, i;
+    int k, first, last, son;
+
+    total = 1;
+    for (k = 0; k < noParts; k++) total += parts[k].c->nodeCount - 1;
+    reserveNodes(total);
+
+    first = last = 0;
+    for (k = 0; k < noParts; k++) {
+        base = cc->nodeCount;
+        from = parts[k].c->nodes;
+        to = cc->nodes + base;
+        for (i = 1; i < parts[k].c->nodeCount; i++) {
+            to[i] = from[i];
+            if (to[i].son) to[i].son += base;
+            if (to[i].brother) to[i].brother += base;
+        }
+        cc->nodeCount += parts[k].c->nodeCount - 1;
+
+        // the declarations are the sons of the PROGRAM node of the part
+        son = from[parts[k].root].son + base;
+        if (last) BROTHER(last) = son;
+        else first = son;
+        for (last = son; BROTHER(last); last = BROTHER(last));
+    }
+
+    k = newNode();
+    KIND(k) = PROGRAM;
+    VALUE(k) = 0;
+    NODEREP(k) = nonterm;
+    SON(k) = first;
+    BROTHER(k) = 0;
+    return k;
+}
+
+// parses the current source(openSource()) like directParser(), on
+// noThreads threads when it is large enough
+int splitParser(int noThreads)
+{
+#ifndef _WIN32
+    PartQueue q;
+    pthread_t *threads;
+    long partSize;
+    int i, root;
+
+    if (noThreads < 2) return directParser();
+    partSize = (sourceEnd - sourceBuffer) / (noThreads * PARTS_PER_THREAD);
+    if (partSize < MIN_PART) partSize = MIN_PART;
+    q.parts = (Part*)calloc(noThreads * PARTS_PER_THREAD, sizeof(Part));
+    threads = (pthread_t*)malloc(noThreads * sizeof(pthread_t));
+    if (!q.parts || !threads) {
+        printf("malloc error in splitParser()\n");
+        exit(1);
+    }
+    q.noParts = cutParts(sourceBuffer, sourceEnd, partSize, q.parts, noThreads * PARTS_PER_THREAD);
+    if (q.noParts < 2) {
+        free(q.parts);
+        free(threads);
+        return directParser();
+    }
+
+    q.nextPart = 0;
+    pthread_mutex_init(&q.lock, NULL);
+    if (noThreads > q.noParts) noThreads = q.noParts;
+    for (i = 0; i < noThreads; i++)
+        if (pthread_create(&threads[i], NULL, partWorker, &q)) {
+            printf("pthread_create error in splitParser()\n");
+            exit(1);
+        }
+    for (i = 0; i < noThreads; i++)
+        pthread_join(threads[i], NULL);
+    pthread_mutex_destroy(&q.lock);
+    free(threads);
+
+    for (i = 0; i < q.noParts && q.parts[i].root; i++);
+    root = i == q.noParts ? spliceParts(q.parts, q.noParts) : 0;
+    for (i = 0; i < q.noParts; i++) freeCompilation(q.parts[i].c);
+    free(q.parts);
+    if (root) return root;
+    return directParser();      // again, with the error messages
+#else
+    return directParser();
+#endif
+}
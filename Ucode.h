@@ -0,0 +1,68 @@
+/*
+ * Ucode definitions shared by ICG and ucodei
+ *
+ * the opcode numbers are those of the object column in the listing of
+ * ucodei and of the binary object file.
+ */
+#ifndef UCODE_H
+#define UCODE_H
+
+enum opcode {
+    notop,  neg,    incop,  decop,  dupop,  swp,    add,    sub,    mult,   divop,
+    modop,  andop,  orop,   gt,     lt,     ge,     le,     eq,     ne,
+    lod,    ldc,    lda,    ldi,    ldp,    str,    sti,    ujp,    tjp,    fjp,
+    call,   ret,    retv,   chkh,   chkl,   nop,    proc,   endop,  bgn,    sym,
+    dump,   jeq,    jne,    jgt,    jlt,    jge,    jle,    none
+};
+
+#define NO_OPCODES (none + 1)
+
+// jeq .. jle pop b and a and jump to their label if a op b holds: the
+// fused form of a relational operator and tjp, or of the opposite one
+// and fjp
+
+static const char *opcodeName[NO_OPCODES] = {
+    "notop", "neg",  "inc",  "dec",  "dup",  "swp",  "add",  "sub",  "mult", "div",
+    "mod",   "and",  "or",   "gt",   "lt",   "ge",   "le",   "eq",   "ne",
+    "lod",   "ldc",  "lda",  "ldi",  "ldp",  "str",  "sti",  "ujp",  "tjp",  "fjp",
+    "call",  "ret",  "retv", "chkh", "chkl", "nop",  "proc", "end",  "bgn",  "sym",
+    "dump",  "jeq",  "jne",  "jgt",  "jlt",  "jge",  "jle",  "none"
+};
+
+// operands in the text form, a label operand counts as one
+static int opcodeOperands[NO_OPCODES] = {
+    /*notop*/ 0, /*neg*/  0, /*inc*/  0, /*dec*/  0, /*dup*/  0,
+    /*swp*/   0, /*add*/  0, /*sub*/  0, /*mult*/ 0, /*div*/  0,
+    /*mod*/   0, /*and*/  0, /*or*/   0, /*gt*/   0, /*lt*/   0,
+    /*ge*/    0, /*le*/   0, /*eq*/   0, /*ne*/   0, /*lod*/  2,
+    /*ldc*/   1, /*lda*/  2, /*ldi*/  0, /*ldp*/  0, /*str*/  2,
+    /*sti*/   0, /*ujp*/  1, /*tjp*/  1, /*fjp*/  1, /*call*/ 1,
+    /*ret*/   0, /*retv*/ 0, /*chkh*/ 1, /*chkl*/ 1, /*nop*/  0,
+    /*proc*/  3, /*end*/  0, /*bgn*/  1, /*sym*/  3, /*dump*/ 0,
+    /*jeq*/   1, /*jne*/  1, /*jgt*/  1, /*jlt*/  1, /*jge*/  1,
+    /*jle*/   1, /*none*/ 0
+};
+
+// binary object file(.uob): a UcodeHeader and the instructions
+// code[0..noInstructions], code[0] is not used so that an address is an
+// index. jumps and calls hold the address of their target, a call of
+// read, write or lf holds READPROC, WRITEPROC or LFPROC.
+#define UCODE_MAGIC     0x424f554d  // "MUOB"
+#define UCODE_VERSION   1
+
+enum procIndex { READPROC = -1, WRITEPROC = -2, LFPROC = -3 };
+
+typedef struct {
+    int magic, version;
+    int noInstructions;
+    int startAddress;               // address of bgn
+} UcodeHeader;
+
+typedef struct {
+    int opcode;
+    int value1;
+    int value2;
+    int value3;
+} UcodeInstruction;
+
+#endif
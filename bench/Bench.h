@@ -0,0 +1,56 @@
+/*
+ * Bench.h - helpers shared by the benches
+ *
+ * included after Scanner.h, Parser.h or Incremental.h. everything is static
+ * inline, a bench that does not use a helper gets no copy and no warning.
+ */
+#include <time.h>
+
+static inline double now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// s as a JSON string, '"' and '\' escaped
+static inline void printString(char *s)
+{
+    putchar('"');
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\') putchar('\\');
+        putchar(*s);
+    }
+    putchar('"');
+}
+
+// the source is scanned once into tokens[] and replayToken(), set as
+// cc->nextToken, hands them to the parser, so that only the parse loop is
+// measured. tokenIndex is reset to 0 before each parse.
+static struct tokenType *tokens;
+static long noTokens, tokensSize, tokenIndex;
+
+static inline struct tokenType replayToken()
+{
+    return tokens[tokenIndex++];
+}
+
+// scan the current source(see setSource) up to and including teof
+static inline void scanTokens()
+{
+    struct tokenType token;
+
+    noTokens = 0;
+    do {
+        token = scanner();
+        if (noTokens == tokensSize) {
+            tokensSize = tokensSize ? 2 * tokensSize : 65536;
+            tokens = (struct tokenType*)realloc(tokens, tokensSize * sizeof(struct tokenType));
+            if (!tokens) {
+                printf("realloc error in scanTokens()\n");
+                exit(1);
+            }
+        }
+        tokens[noTokens++] = token;
+    } while (token.number != teof);
+}
@@ -0,0 +1,273 @@
+/*
+ * GetcharScanner - the scanner of the first icg, the baseline of ScanBench
+ *
+ * reads the source one character at a time with getc() and retracts with
+ * ungetc(), copies every identifier into the token and looks keywords up
+ * with strcmp(). it is included by ScanBench.c. the differences to the
+ * original are only those needed to run it there:
+ *   - it reads getcharSource instead of stdin
+ *   - characters are int and the comment loops stop at EOF, so that a
+ *     file with an unterminated comment does not hang the bench
+ *   - lexical errors are counted, not printed
+ */
+#define GETCHAR_ID_LENGTH 12
+
+struct getcharToken {
+    int number; // token number
+    union {
+        char id[GETCHAR_ID_LENGTH];     // identifier
+        int num;                        // number
+    } value;    // token value
+};
+
+static FILE *getcharSource;
+static long getcharErrors;
+
+#define getchar()   getc(getcharSource)
+#define retract(ch) ungetc(ch, getcharSource)
+
+static int getcharHexValue(int ch)
+{
+    switch (ch) {
+    case '0': case '1': case '2': case '3': case '4':
+    case '5': case '6': case '7': case '8': case '9':
+        return (ch - '0');
+
+    case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+        return(ch - 'A' + 10);
+    case 'a': case 'b': case 'c': case 'd': case 'e': case 'f':
+        return(ch - 'a' + 10);
+
+    default: return -1;
+
+    }
+}
+
+static int getcharIntNum(int firstCharacter)
+{
+    int num = 0;
+    int value;
+    int ch;
+
+    if (firstCharacter != '0') {
+        ch = firstCharacter;
+        do {
+            num = 10 * num + (int)(ch - '0');
+            ch = getchar();
+        } while (isdigit(ch));
+    }
+    else {
+        ch = getchar();
+        if ((ch >= '0') && (ch <= '7')) {   // octal
+            do {
+                num = 8 * num + (int)(ch - '0');
+                ch = getchar();
+            } while ((ch >= '0') && (ch <= '7'));
+        }
+        else if ((ch == 'X') || (ch == 'x')) {  // hexa decimal
+            while ((value = getcharHexValue(ch = getchar())) != -1)
+                num = 16 * num + value;
+        }
+        else {  // zero
+            num = 0;
+        }
+    }
+    retract(ch);
+    return num;
+}
+
+static struct getcharToken getcharScanner()
+{
+    struct getcharToken token;
+    int i, index;
+    int ch;
+    char id[GETCHAR_ID_LENGTH];
+
+    token.number = tnull;
+
+    do {
+        while (isspace(ch = getchar())); // state 1: skip blanks
+
+        // identifier or keyword
+        if (isalpha(ch) || ch == '_') {
+            i = 0;
+
+            // 영문자, 숫자, _를 한 글자씩 읽어서 id를 구성.
+            do {
+                if (i < GETCHAR_ID_LENGTH) id[i++] = ch;
+                ch = getchar();
+            } while (isalnum(ch) || ch == '_');
+            if (i >= GETCHAR_ID_LENGTH) {
+                getcharErrors++;
+                i = 0;
+            }
+            id[i] = '\0';
+            retract(ch);
+
+            // find the identifier in the keyword table
+            for (index = 0; index < NO_KEYWORDS; index++)
+                if (!strcmp(id, keyword[index])) break;
+
+            if (index < NO_KEYWORDS) {   // found, keyword exit
+                token.number = tnum[index];
+            }
+
+            else {  // not found, identifier exit
+                token.number = tident;
+                strcpy(token.value.id, id);
+            }
+        } // end of identifier(token.number) or keyword(token.value.id)
+
+        // integer constant
+        else if (isdigit(ch)) {
+            token.number = tnumber;
+            token.value.num = getcharIntNum(ch);
+        }
+
+        // special character
+        else switch (ch) {
+        case '/': // state 10
+            ch = getchar();
+            if (ch == '*') {
+                ch = getchar();
+                if (ch != '*') {    // text comment
+                    do {
+                        while (ch != '*' && ch != EOF) ch = getchar();
+                        ch = getchar();
+                    } while (ch != '/' && ch != EOF);
+                }
+                else {  // /**
+                    ch = getchar();
+                    if (ch == '/'); // text comment
+                    else {          // document comment
+                        do {
+                            while (ch != '*' && ch != EOF) ch = getchar();
+                            ch = getchar();
+                        } while (ch != '/' && ch != EOF);
+                    }
+                }
+            }
+            else if (ch == '/') // line comment
+                while ((ch = getchar()) != '\n' && ch != EOF);
+            else if (ch == '=') {
+                token.number = tdivAssign;
+            }
+            else {
+                token.number = tdiv;
+                retract(ch);
+            }
+            break;
+
+        case '!':   // state 17
+            ch = getchar();
+            if (ch == '=') token.number = tnotequ;
+            else {
+                token.number = tnot;
+                retract(ch);
+            }
+            break;
+
+        case '%':   // state 20
+            ch = getchar();
+            if (ch == '=') token.number = tmodAssign;
+            else {
+                token.number = tmod;
+                retract(ch);
+            }
+            break;
+
+        case '&': // state 23
+            ch = getchar();
+            if (ch == '&') token.number = tand;
+            else {
+                getcharErrors++;
+                retract(ch);
+            }
+            break;
+
+        case '*': // state 25
+            ch = getchar();
+            if (ch == '=') token.number = tmulAssign;
+            else {
+                token.number = tmul;
+                retract(ch);
+            }
+            break;
+
+        case '+': // state 28
+            ch = getchar();
+            if (ch == '+') token.number = tinc;
+            else if (ch == '=') token.number = taddAssign;
+            else {
+                token.number = tplus;
+                retract(ch);
+            }
+            break;
+
+        case '-':   // state 32
+            ch = getchar();
+            if (ch == '-') token.number = tdec;
+            else if (ch == '=') token.number = tsubAssign;
+            else {
+                token.number = tminus;
+                retract(ch);
+            }
+            break;
+
+        case '<':   // state 36
+            ch = getchar();
+            if (ch == '=') token.number = tlesse;
+            else {
+                token.number = tless;
+                retract(ch);
+            }
+            break;
+
+        case '=':   // state 39
+            ch = getchar();
+            if (ch == '=') token.number = tequal;
+            else {
+                token.number = tassign;
+                retract(ch);
+            }
+            break;
+
+        case '>':   //state 42
+            ch = getchar();
+            if (ch == '=') token.number = tgreate;
+            else {
+                token.number = tgreat;
+                retract(ch);
+            }
+            break;
+
+        case '|':   // state 45
+            ch = getchar();
+            if (ch == '|') token.number = tor;
+            else {
+                getcharErrors++;
+                retract(ch);
+            }
+            break;
+
+        case '(': token.number = tlparen;    break;
+        case ')': token.number = trparen;    break;
+        case ',': token.number = tcomma;     break;
+        case ';': token.number = tsemicolon; break;
+        case '[': token.number = tlbracket;  break;
+        case ']': token.number = trbracket;  break;
+        case '{': token.number = tlbrace;    break;
+        case '}': token.number = trbrace;    break;
+        case EOF: token.number = teof;       break;
+
+        default:
+            getcharErrors++;
+            break;
+
+        } // switch end
+    } while (token.number == tnull);
+    return token;
+}   // end of getcharScanner
+
+#undef getchar
+#undef retract
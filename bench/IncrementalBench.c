@@ -0,0 +1,191 @@
+/*
+ * IncrementalBench - re-parse after an edit against a full parse
+ *
+ *   cc -O2 -I.. -o incbench IncrementalBench.c ../Incremental.c ../Parser.c \
+ *       ../Scanner.c -lpthread
+ *
+ *   incbench file.mc [edits]
+ *
+ * the file is parsed once with incrementalParse(), then edits small
+ * edits are applied one after another with incrementalEdit(). the edits
+ * are picked by a fixed pseudo random sequence and cycle through
+ *   number  a number token gets one more digit
+ *   blank   a newline is inserted before a token
+ *   ident   an identifier gets one more character
+ *   copy    a top-level declaration is inserted once more after itself
+ *   delete  a top-level declaration is removed
+ * after each edit the whole edited text is scanned and parsed again in a
+ * second compilation and both trees are compared node by node; a
+ * difference is reported and ends the bench with status 1, so the bench
+ * also serves as the test of Incremental.c.
+ * large inputs can be generated with "scanbench -mix mixed -size 1 -gen
+ * mid.mc". one JSON object per edit kind is printed:
+ *   {"bench":"incremental","edit":...,"file":...,"bytes":...,"dcls":...,
+ *    "edits":...,"full_seconds":...,"edit_seconds":...,"speedup":...}
+ * the seconds are per edit; full_seconds is scan and parse of the whole
+ * text, edit_seconds is incrementalEdit() including its own scan.
+ */
+#include "Incremental.h"
+#include "Bench.h"
+
+enum { EDIT_NUMBER, EDIT_BLANK, EDIT_IDENT, EDIT_COPY, EDIT_DELETE, NO_EDITS };
+static char *editName[NO_EDITS] = { "number", "blank", "ident", "copy", "delete" };
+
+static double fullSeconds[NO_EDITS], editSeconds[NO_EDITS];
+static int noEdits[NO_EDITS];
+
+static unsigned long seed = 12345;
+
+static int pick(int n)
+{
+    seed = seed * 1103515245 + 12345;
+    return (int)((seed >> 16) % n);
+}
+
+// compare the trees p in a and q in b, brothers iteratively
+static int sameTree(Node *a, int p, Node *b, int q)
+{
+    while (p && q) {
+        if (a[p].number != b[q].number || a[p].noderep != b[q].noderep
+                || a[p].value != b[q].value)
+            return 0;
+        if (!sameTree(a, a[p].son, b, b[q].son)) return 0;
+        p = a[p].brother;
+        q = b[q].brother;
+    }
+    return !p && !q;
+}
+
+// a token of the given kind in a random declaration, returns 0 if the
+// declaration has none; *at and *end get its absolute range
+static int findToken(IncrementalUnit *u, int number, long *at, long *end)
+{
+    ExternalDcl *d = &u->dcls[pick(u->noDcls)];
+    int i, t;
+
+    t = pick(d->noTokens);
+    for (i = 0; i < d->noTokens; i++, t = (t + 1) % d->noTokens)
+        if (number == tnull || d->tokens[t].token.number == number) {
+            *at = d->start + d->tokens[t].start;
+            *end = d->start + d->tokens[t].end;
+            return 1;
+        }
+    return 0;
+}
+
+// apply one edit of the given kind, returns 0 if it does not apply
+static int edit(IncrementalUnit *u, int kind)
+{
+    ExternalDcl *d;
+    long at, end;
+    char *copy;
+
+    switch (kind) {
+    case EDIT_NUMBER:
+        if (!findToken(u, tnumber, &at, &end) || end - at > 8) return 0;
+        incrementalEdit(u, end, 0, "7", 1);
+        return 1;
+    case EDIT_BLANK:
+        findToken(u, tnull, &at, &end);
+        incrementalEdit(u, at, 0, "\n", 1);
+        return 1;
+    case EDIT_IDENT:
+        if (!findToken(u, tident, &at, &end)) return 0;
+        incrementalEdit(u, end, 0, "_", 1);
+        return 1;
+    case EDIT_COPY:
+        d = &u->dcls[pick(u->noDcls)];
+        copy = (char*)malloc(d->end - d->start + 1);
+        if (!copy) {
+            printf("malloc error in edit()\n");
+            exit(1);
+        }
+        copy[0] = '\n';
+        memcpy(copy + 1, u->text + d->start, d->end - d->start);
+        incrementalEdit(u, d->end, 0, copy, d->end - d->start + 1);
+        free(copy);
+        return 1;
+    case EDIT_DELETE:
+        if (u->noDcls < 2) return 0;
+        d = &u->dcls[pick(u->noDcls)];
+        incrementalEdit(u, d->start, d->end - d->start, "", 0);
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    IncrementalUnit u;
+    Compilation *inc, *full;
+    double start, elapsed;
+    char *text;
+    long length;
+    int edits, i, kind, root;
+
+    if (argc < 2) {
+        printf("usage: incbench file.mc [edits]\n");
+        exit(1);
+    }
+    edits = argc > 2 ? atoi(argv[2]) : 50;
+    if (!openSource(argv[1])) {
+        printf("cannot open %s\n", argv[1]);
+        exit(1);
+    }
+
+    // incrementalParse() scans its own copy of the text
+    length = sourceEnd - sourceBuffer;
+    text = (char*)malloc(length + 1);
+    if (!text) {
+        printf("malloc error in main()\n");
+        exit(1);
+    }
+    memcpy(text, sourceBuffer, length);
+    closeSource();
+
+    initParsingTable();
+    inc = newCompilation();
+    full = newCompilation();
+    cc = inc;
+    if (!incrementalParse(&u, text, length) || cc->errcnt) {
+        printf("%s does not parse\n", argv[1]);
+        return 1;
+    }
+    free(text);
+
+    for (i = 0; i < edits; i++) {
+        kind = i % NO_EDITS;
+        cc = inc;
+        start = now();
+        if (!edit(&u, kind)) continue;
+        elapsed = now() - start;
+
+        cc = full;
+        freeNodes();
+        start = now();
+        setSource(u.text, u.length);
+        root = parser();
+        fullSeconds[kind] += now() - start;
+        editSeconds[kind] += elapsed;
+        noEdits[kind]++;
+
+        if (inc->errcnt || full->errcnt
+                || !sameTree(inc->nodes, u.root, full->nodes, root)) {
+            printf("edit %d(%s): incrementalEdit() and parser() built different trees\n",
+                    i, editName[kind]);
+            return 1;
+        }
+    }
+
+    for (kind = 0; kind < NO_EDITS; kind++) {
+        if (!noEdits[kind]) continue;
+        printf("{\"bench\":\"incremental\",\"edit\":\"%s\",\"file\":", editName[kind]);
+        printString(argv[1]);
+        printf(",\"bytes\":%ld,\"dcls\":%d,\"edits\":%d,\"full_seconds\":%.6f,"
+                "\"edit_seconds\":%.6f,\"speedup\":%.1f}\n",
+                u.length, u.noDcls, noEdits[kind], fullSeconds[kind] / noEdits[kind],
+                editSeconds[kind] / noEdits[kind], fullSeconds[kind] / editSeconds[kind]);
+    }
+    incrementalFree(&u);
+    return 0;
+}
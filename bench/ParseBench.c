@@ -0,0 +1,93 @@
+/*
+ * ParseBench - parse loop throughput
+ *
+ *   cc -O2 -I.. -o parsebench ParseBench.c ../Parser.c ../DirectParser.c \
+ *       ../Scanner.c -lpthread
+ *   cc -O2 -I.. -DDENSE_TABLE -o parsebench-dense ParseBench.c ../Parser.c \
+ *       ../DirectParser.c ../Scanner.c -lpthread
+ *
+ *   parsebench file.mc [repeat]
+ *
+ * the file is scanned once into a token array, then the table driven
+ * parser() and the generated directParser() run over the array repeat
+ * times each so that only the parse loop is measured. the trees of the
+ * two parsers are compared node by node.
+ * large inputs can be generated with "scanbench -mix mixed -size 32 -gen
+ * big.mc". one JSON object per line is printed:
+ *   {"bench":"parser","table":"packed"|"dense"|"direct","file":...,"tokens":...,
+ *    "seconds":...,"tokens_per_sec":...,"nodes":...,"node_bytes":...,
+ *    "allocated_bytes":...,"reallocs":...}
+ * the node counts are per parse; the node array is freed after each one.
+ */
+#include "Parser.h"
+#include "Bench.h"
+
+#ifdef DENSE_TABLE
+#define TABLE "dense"
+#else
+#define TABLE "packed"
+#endif
+
+static int root;        // tree of the last parse
+
+static void measure(int (*parse)(), char *name, char *fileName, int repeat)
+{
+    double start, elapsed;
+    int i;
+
+    cc->nodeGrowths = 0;
+    start = now();
+    for (i = 0; i < repeat; i++) {
+        tokenIndex = 0;
+        root = parse();
+        if (i < repeat - 1) {
+            freeNodes();
+            cc->nodeGrowths = 0;
+        }
+    }
+    elapsed = now() - start;
+    printf("{\"bench\":\"parser\",\"table\":\"%s\",\"file\":", name);
+    printString(fileName);
+    printf(",\"tokens\":%ld,"
+            "\"seconds\":%.6f,\"tokens_per_sec\":%.0f,\"nodes\":%ld,\"node_bytes\":%ld,"
+            "\"allocated_bytes\":%ld,\"reallocs\":%ld}\n",
+            noTokens * repeat, elapsed, noTokens * repeat / elapsed,
+            cc->nodeCount, cc->nodeCount * (long)sizeof(Node), cc->nodeSize * (long)sizeof(Node),
+            cc->nodeGrowths);
+}
+
+int main(int argc, char *argv[])
+{
+    long noNodes;
+    int repeat, tableRoot;
+    Node *tableNodes;
+
+    if (argc < 2) {
+        printf("usage: parsebench file.mc [repeat]\n");
+        exit(1);
+    }
+    repeat = argc > 2 ? atoi(argv[2]) : 5;
+    if (!openSource(argv[1])) {
+        printf("cannot open %s\n", argv[1]);
+        exit(1);
+    }
+    scanTokens();
+    closeSource();
+
+    initParsingTable();
+    cc = newCompilation();
+    cc->nextToken = replayToken;
+    measure(parser, TABLE, argv[1], repeat);
+    tableNodes = cc->nodes;
+    tableRoot = root;
+    noNodes = cc->nodeCount;
+    cc->nodes = NULL;
+    cc->nodeCount = cc->nodeSize = 0;
+    measure(directParser, "direct", argv[1], repeat);
+    if (root != tableRoot || cc->nodeCount != noNodes
+            || memcmp(cc->nodes + 1, tableNodes + 1, noNodes * sizeof(Node))) {
+        printf("directParser() and parser() built different trees\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,139 @@
+/*
+ * ScaleBench - parse time against list length
+ *
+ *   cc -O2 -I.. -o scalebench ScaleBench.c ../Parser.c ../Scanner.c -lpthread
+ *
+ *   scalebench [-list name] [-min n] [-max n] [-repeat n]
+ *
+ * generates sources with one long list built by a left recursive rule
+ * and times parser() over them for n = min, 2*min, ..., max items:
+ *     stmt    n statements in one function(statement_list)
+ *     dcl     n local declarations(declaration_list)
+ *     init    n declarators in one declaration(init_dcl_list)
+ *     unit    n functions(translation_unit)
+ *     all     each of the above in turn(default)
+ * the source is scanned once into a token array, only parser() is
+ * timed. with linear list building ns_per_item stays about the same as
+ * n grows. one JSON object per line is printed:
+ *   {"bench":"parser_scaling","list":"stmt","items":...,"tokens":...,
+ *    "seconds":...,"ns_per_item":...}
+ */
+#include "Parser.h"
+#include "Bench.h"
+
+enum listKind { LIST_STMT, LIST_DCL, LIST_INIT, LIST_UNIT, NO_LISTS };
+
+char *listName[NO_LISTS] = { "stmt", "dcl", "init", "unit" };
+
+static char *text;
+static long length, size;
+
+static void put(char *s)
+{
+    long n = strlen(s);
+
+    if (length + n > size) {
+        size = 2 * size + n;
+        text = (char*)realloc(text, size);
+        if (!text) {
+            printf("realloc error in put()\n");
+            exit(1);
+        }
+    }
+    memcpy(text + length, s, n);
+    length += n;
+}
+
+static void generate(int list, long n)
+{
+    char buf[64];
+    long i;
+
+    length = 0;
+    switch (list) {
+    case LIST_STMT:
+        put("void main()\n{\n    int i, s;\n");
+        for (i = 0; i < n; i++)
+            put(i % 2 ? "    s = s + i;\n" : "    ++i;\n");
+        put("}\n");
+        break;
+    case LIST_DCL:
+        put("void main()\n{\n");
+        for (i = 0; i < n; i++) {
+            sprintf(buf, "    int v%ld;\n", i);
+            put(buf);
+        }
+        put("    v0 = 1;\n}\n");
+        break;
+    case LIST_INIT:
+        put("int v0");
+        for (i = 1; i < n; i++) {
+            sprintf(buf, ", v%ld", i);
+            put(buf);
+        }
+        put(";\nvoid main()\n{\n    v0 = 1;\n}\n");
+        break;
+    default:
+        for (i = 0; i < n; i++) {
+            sprintf(buf, "void f%ld()\n{\n    return;\n}\n", i);
+            put(buf);
+        }
+        break;
+    }
+}
+
+static void measure(int list, long n, int repeat)
+{
+    double start, elapsed;
+    int i;
+
+    generate(list, n);
+    setSource(text, length);
+    scanTokens();
+    start = now();
+    for (i = 0; i < repeat; i++) {
+        tokenIndex = 0;
+        parser();
+        freeNodes();
+    }
+    elapsed = (now() - start) / repeat;
+    printf("{\"bench\":\"parser_scaling\",\"list\":\"%s\",\"items\":%ld,\"tokens\":%ld,"
+            "\"seconds\":%.6f,\"ns_per_item\":%.1f}\n",
+            listName[list], n, noTokens, elapsed, elapsed * 1e9 / n);
+    fflush(stdout);
+}
+
+int main(int argc, char *argv[])
+{
+    int list = -1, repeat = 3, i;
+    long n, min = 1000, max = 256000;
+
+    for (i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-list") && i + 1 < argc) {
+            i++;
+            for (list = 0; list < NO_LISTS && strcmp(argv[i], listName[list]); list++);
+            if (list == NO_LISTS) list = -1;    // all
+        }
+        else if (!strcmp(argv[i], "-min") && i + 1 < argc)
+            min = atol(argv[++i]);
+        else if (!strcmp(argv[i], "-max") && i + 1 < argc)
+            max = atol(argv[++i]);
+        else if (!strcmp(argv[i], "-repeat") && i + 1 < argc)
+            repeat = atoi(argv[++i]);
+        else {
+            printf("usage: scalebench [-list name] [-min n] [-max n] [-repeat n]\n");
+            exit(1);
+        }
+    }
+    if (min < 1) min = 1;
+
+    initParsingTable();
+    cc = newCompilation();
+    cc->nextToken = replayToken;
+    for (i = 0; i < NO_LISTS; i++) {
+        if (list >= 0 && i != list) continue;
+        for (n = min; n <= max; n *= 2)
+            measure(i, n, repeat);
+    }
+    return 0;
+}
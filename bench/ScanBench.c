@@ -0,0 +1,292 @@
+/*
+ * ScanBench - scanner throughput
+ *
+ *   cc -O2 -I.. -o scanbench ScanBench.c ../Scanner.c -lpthread
+ *
+ *   scanbench [-mix name] [-size MB] [-repeat n] [-mode name] [-seed n]
+ *             [-gen file] [file.mc]
+ *
+ * measures scanner() alone over a file or over generated MiniC text of
+ * the given size and mix:
+ *     ident     identifiers and keywords
+ *     number    decimal, octal and hexadecimal literals(getIntNum)
+ *     comment   text, empty and line comments between a few tokens
+ *     operator  every operator and delimiter case of scanner()
+ *     mixed     function definitions like the generated sources
+ *     all       each of the above in turn(default)
+ * every character run mode the cpu supports is measured unless -mode
+ * is given, and as the baseline mode "getchar" the getc()/ungetc()
+ * scanner of the first icg(see GetcharScanner.c), which reads the text
+ * from a temporary file. -gen writes the generated text to a file instead.
+ *
+ * one JSON object per line is printed for each mix and mode:
+ *   {"bench":"scanner","mix":"ident","mode":"avx2","bytes":...,
+ *    "tokens":...,"seconds":...,"bytes_per_sec":...,"tokens_per_sec":...}
+ */
+#include "Scanner.h"
+#include "Bench.h"
+#include "GetcharScanner.c"
+
+#define ALL_MODES       (-1)
+#define MODE_GETCHAR    (-2)
+
+enum mixKind { MIX_IDENT, MIX_NUMBER, MIX_COMMENT, MIX_OPERATOR, MIX_MIXED, NO_MIXES };
+
+char *mixName[NO_MIXES] = { "ident", "number", "comment", "operator", "mixed" };
+
+static char *text;
+static long length, size;
+static unsigned long seed = 1;
+
+static unsigned int random32()
+{
+    seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+    return (unsigned int)(seed >> 33);
+}
+
+static void put(char *s)
+{
+    long n = strlen(s);
+
+    if (length + n > size) {
+        size = 2 * size + n;
+        text = (char*)realloc(text, size);
+        if (!text) {
+            printf("realloc error in put()\n");
+            exit(1);
+        }
+    }
+    memcpy(text + length, s, n);
+    length += n;
+}
+
+static void putIdent()
+{
+    static char *stem[] = {
+        "i", "j", "n", "sum", "count", "index", "value", "buffer", "temp_1",
+        "_tmp", "matrixRow", "very_long_generated_identifier_42", "x9",
+        "int", "if", "while", "return", "const", "void", "else"
+    };
+    char buf[64];
+
+    sprintf(buf, "%s", stem[random32() % (sizeof(stem) / sizeof(stem[0]))]);
+    put(buf);
+}
+
+static void putNumber()
+{
+    char buf[32];
+
+    switch (random32() % 4) {
+    case 0: sprintf(buf, "%u", random32() % 100000); break;
+    case 1: sprintf(buf, "0%o", random32() % 65536); break;
+    case 2: sprintf(buf, "0x%X", random32()); break;
+    default: sprintf(buf, "0"); break;
+    }
+    put(buf);
+}
+
+static void putComment()
+{
+    static char *words[] = { "the", "loop", "index", "*", "walks", "over", "a[i]", "/" };
+    int i, n = random32() % 24;
+
+    switch (random32() % 3) {
+    case 0:
+        put("/*");
+        for (i = 0; i < n; i++) {
+            put(" ");
+            put(words[random32() % 8]);
+            if (random32() % 6 == 0) put("\n   ");
+        }
+        put(" */");
+        break;
+    case 1:
+        put("//");
+        for (i = 0; i < n; i++) {
+            put(" ");
+            put(words[random32() % 8]);
+        }
+        put("\n");
+        break;
+    default:
+        put("/**/");
+        break;
+    }
+}
+
+static void putOperator()
+{
+    static char *op[] = {
+        "/", "/=", "!", "!=", "%", "%=", "&&", "*", "*=", "+", "++", "+=",
+        "-", "--", "-=", "<", "<=", "=", "==", ">", ">=", "||",
+        "(", ")", ",", ";", "[", "]", "{", "}"
+    };
+
+    put(op[random32() % (sizeof(op) / sizeof(op[0]))]);
+}
+
+static void putBlank()
+{
+    static char *blank[] = { " ", " ", " ", "\n", "\n    ", "\t", "\r\n", "  " };
+
+    put(blank[random32() % 8]);
+}
+
+static void putFunction()
+{
+    char buf[256];
+    int i, n = 4 + random32() % 12;
+
+    sprintf(buf, "int f%u(int a, int b)\n{\n    int i, s;\n    int t[16];\n", random32());
+    put(buf);
+    for (i = 0; i < n; i++) {
+        switch (random32() % 6) {
+        case 0: put("    i = 0;\n"); break;
+        case 1: put("    while (i < a && t[i % 16] != 0x1F) {\n        s += t[i];\n        ++i;\n    }\n"); break;
+        case 2: put("    if (s >= 0755) s = s - b * 2; else s = -s;\n"); break;
+        case 3: put("    /* accumulate the partial sums */\n"); break;
+        case 4: put("    t[s % 16] = a / (b + 1) + i--;\n"); break;
+        default: put("    // keep the invariant\n    s = !s || a <= b;\n"); break;
+        }
+    }
+    put("    return s;\n}\n\n");
+}
+
+static void generate(int mix, long bytes)
+{
+    length = 0;
+    while (length < bytes) {
+        switch (mix) {
+        case MIX_IDENT:
+            putIdent();
+            if (random32() % 4 == 0) putOperator();
+            break;
+        case MIX_NUMBER:
+            putNumber();
+            put(random32() % 2 ? "," : ";");
+            break;
+        case MIX_COMMENT:
+            putComment();
+            if (random32() % 3 == 0) putIdent();
+            break;
+        case MIX_OPERATOR:
+            putOperator();
+            break;
+        default:
+            putFunction();
+            continue;
+        }
+        putBlank();
+    }
+}
+
+static void measure(char *mix, int mode, int repeat)
+{
+    long scanned;
+    int i;
+    double start, elapsed;
+
+    scanned = 0;
+    if (mode == MODE_GETCHAR) {
+        if ((getcharSource = tmpfile()) == NULL) {
+            printf("cannot open a temporary file\n");
+            exit(1);
+        }
+        fwrite(text, 1, length, getcharSource);
+    }
+    else setSource(text, length);
+    start = now();
+    for (i = 0; i < repeat; i++) {
+        if (mode == MODE_GETCHAR) {
+            rewind(getcharSource);
+            while (getcharScanner().number != teof) scanned++;
+        }
+        else {
+            cp = text;
+            while (scanner().number != teof) scanned++;
+        }
+    }
+    elapsed = now() - start;
+    if (mode == MODE_GETCHAR) fclose(getcharSource);
+    printf("{\"bench\":\"scanner\",\"mix\":");
+    printString(mix);
+    printf(",\"mode\":\"%s\",\"bytes\":%ld,"
+            "\"tokens\":%ld,\"seconds\":%.6f,\"bytes_per_sec\":%.0f,\"tokens_per_sec\":%.0f}\n",
+            mode == MODE_GETCHAR ? "getchar" : scanModeName[mode], length * (long)repeat,
+            scanned, elapsed, length * (double)repeat / elapsed, scanned / elapsed);
+}
+
+int main(int argc, char *argv[])
+{
+    char *fileName = NULL, *genName = NULL;
+    int mix = -1, repeat = 5, mode = ALL_MODES, first, last, i, m;
+    long bytes = 16L << 20;
+    FILE *fp;
+
+    for (i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-mix") && i + 1 < argc) {
+            i++;
+            for (mix = 0; mix < NO_MIXES && strcmp(argv[i], mixName[mix]); mix++);
+            if (mix == NO_MIXES) mix = -1;      // all
+        }
+        else if (!strcmp(argv[i], "-size") && i + 1 < argc)
+            bytes = (long)(atof(argv[++i]) * (1 << 20));
+        else if (!strcmp(argv[i], "-repeat") && i + 1 < argc)
+            repeat = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-seed") && i + 1 < argc)
+            seed = strtoul(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "-gen") && i + 1 < argc)
+            genName = argv[++i];
+        else if (!strcmp(argv[i], "-mode") && i + 1 < argc) {
+            i++;
+            for (mode = SCAN_SCALAR; mode <= SCAN_AVX2 && strcmp(argv[i], scanModeName[mode]); mode++);
+            if (!strcmp(argv[i], "getchar")) mode = MODE_GETCHAR;
+            else if (mode > SCAN_AVX2) {
+                printf("unknown mode %s\n", argv[i]);
+                exit(1);
+            }
+        }
+        else if (argv[i][0] != '-') fileName = argv[i];
+        else {
+            printf("usage: scanbench [-mix name] [-size MB] [-repeat n] [-mode name]"
+                    " [-seed n] [-gen file] [file.mc]\n");
+            exit(1);
+        }
+    }
+
+    if (genName) {
+        generate(mix < 0 ? MIX_MIXED : mix, bytes);
+        if ((fp = fopen(genName, "wb")) == NULL) {
+            printf("cannot open %s\n", genName);
+            exit(1);
+        }
+        fwrite(text, 1, length, fp);
+        fclose(fp);
+        return 0;
+    }
+
+    if (fileName) {
+        if (!openSource(fileName)) {
+            printf("cannot open %s\n", fileName);
+            exit(1);
+        }
+        text = sourceBuffer;
+        length = sourceEnd - sourceBuffer;
+    }
+
+    first = mix < 0 ? 0 : mix;
+    last = mix < 0 ? NO_MIXES - 1 : mix;
+    for (; first <= last; first++) {
+        if (!fileName) generate(first, bytes);
+        if (mode == ALL_MODES || mode == MODE_GETCHAR)
+            measure(fileName ? fileName : mixName[first], MODE_GETCHAR, repeat);
+        for (m = SCAN_SCALAR; m <= SCAN_AVX2; m++) {
+            if (mode != ALL_MODES && m != mode) continue;
+            if (setScanMode(m) != m) continue;
+            measure(fileName ? fileName : mixName[first], m, repeat);
+        }
+        if (fileName) break;
+    }
+    return 0;
+}
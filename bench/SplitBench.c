@@ -0,0 +1,84 @@
+/*
+ * SplitBench - parallel front end against the parse on one thread
+ *
+ *   cc -O2 -I.. -o splitbench SplitBench.c ../SplitParser.c ../Parser.c \
+ *       ../DirectParser.c ../Scanner.c -lpthread
+ *
+ *   splitbench file.mc [max threads] [repeat]
+ *
+ * scans and parses the file with directParser() on one thread, then
+ * with splitParser() on 2, 4, ... max threads(default 8), and compares
+ * the trees node by node. the parse on one thread runs first, so every
+ * identifier has its id before the threads start and the node arrays
+ * must be equal byte for byte. a file of many functions can be made with
+ * "scanbench -mix mixed -size 32 -gen big.mc". one JSON object per line:
+ *   {"bench":"split_parser","file":...,"threads":...,"bytes":...,
+ *    "seconds":...,"mb_per_sec":...,"nodes":...}
+ */
+#include "Parser.h"
+#include "Bench.h"
+
+static char *text;
+static long length;
+
+static int root;        // tree of the last parse
+
+static void measure(char *fileName, int noThreads, int repeat)
+{
+    double start, elapsed;
+    int i;
+
+    start = now();
+    for (i = 0; i < repeat; i++) {
+        if (i) freeNodes();
+        setSource(text, length);
+        root = noThreads > 1 ? splitParser(noThreads) : directParser();
+    }
+    elapsed = (now() - start) / repeat;
+    printf("{\"bench\":\"split_parser\",\"file\":");
+    printString(fileName);
+    printf(",\"threads\":%d,\"bytes\":%ld,"
+            "\"seconds\":%.6f,\"mb_per_sec\":%.1f,\"nodes\":%ld}\n",
+            noThreads, length, elapsed, length / elapsed / 1e6, cc->nodeCount);
+    fflush(stdout);
+}
+
+int main(int argc, char *argv[])
+{
+    int maxThreads, repeat, noThreads, oneRoot;
+    long noNodes;
+    Node *oneNodes;
+
+    if (argc < 2) {
+        printf("usage: splitbench file.mc [max threads] [repeat]\n");
+        exit(1);
+    }
+    maxThreads = argc > 2 ? atoi(argv[2]) : 8;
+    repeat = argc > 3 ? atoi(argv[3]) : 3;
+    if (!openSource(argv[1])) {
+        printf("cannot open %s\n", argv[1]);
+        exit(1);
+    }
+    text = sourceBuffer;
+    length = sourceEnd - sourceBuffer;
+
+    initParsingTable();
+    cc = newCompilation();
+    measure(argv[1], 1, repeat);
+    oneNodes = cc->nodes;
+    oneRoot = root;
+    noNodes = cc->nodeCount;
+    cc->nodes = NULL;
+    cc->nodeCount = cc->nodeSize = 0;
+
+    for (noThreads = 2; noThreads <= maxThreads; noThreads *= 2) {
+        freeNodes();
+        measure(argv[1], noThreads, repeat);
+        if (root != oneRoot || cc->nodeCount != noNodes
+                || memcmp(cc->nodes + 1, oneNodes + 1, noNodes * sizeof(Node))) {
+            printf("splitParser(%d) and directParser() built different trees\n", noThreads);
+            return 1;
+        }
+    }
+    return 0;
+}
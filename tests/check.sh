@@ -0,0 +1,74 @@
+#!/bin/sh
+#
+# check.sh - compiler regression
+#
+#   cd tests && sh check.sh
+#
+# icg is built with the packed table and with -DDENSE_TABLE. every
+# syntaxN.mc is compiled by the generated directParser() and by the table
+# driven parser()(-t) of both builds; the messages and the exit status
+# have to equal syntaxN.out, and no .uco may be left behind.
+# incremental.mc is edited by bench/IncrementalBench.c, which compares
+# the tree after each incremental re-parse with a full parse.
+# every program in PROGRAMS is compiled without and with -O, to text
+# Ucode and to an object file(-u), and each of the four is run by ucodei;
+# its output has to equal name.out. ucodei.cpp is pre-standard C++, it is
+# built with the headers and the main() in compat.
+#
+CC=${CC:-cc}
+CXX=${CXX:-c++}
+B=${TMPDIR:-/tmp}/icg-check.$$
+SRC="ICG.c Parser.c Scanner.c DirectParser.c SplitParser.c"
+PROGRAMS="object peephole fold logic branch loops dead inline address"
+mkdir -p $B || exit 1
+trap 'rm -rf $B' 0
+(cd .. && $CC -O2 -o $B/icg $SRC -lpthread &&
+          $CC -O2 -DDENSE_TABLE -o $B/icg-dense $SRC -lpthread &&
+          $CC -O2 -I. -o $B/incbench bench/IncrementalBench.c Incremental.c \
+              Parser.c Scanner.c -lpthread &&
+          $CXX -O2 -w -Itests/compat -Dmain=ucodei_main -c -o $B/ucodei.o ucodei.cpp &&
+          $CXX -O2 -o $B/ucodei tests/compat/main.cpp $B/ucodei.o) || exit 1
+
+fail=0
+for f in syntax*.mc; do
+    n=${f%.mc}
+    for run in "icg" "icg -t" "icg-dense -t"; do
+        rm -f $n.uco
+        $B/$run $f > $B/out 2>&1
+        echo "exit $?" >> $B/out
+        if ! cmp -s $B/out $n.out || [ -f $n.uco ]; then
+            echo "FAIL: $run $f"
+            diff $n.out $B/out
+            fail=1
+        fi
+    done
+    rm -f $n.uco
+done
+if ! $B/incbench incremental.mc 500 > $B/out; then
+    cat $B/out
+    echo "FAIL: incbench incremental.mc"
+    fail=1
+fi
+for n in $PROGRAMS; do
+    cp $n.mc $B
+    for opt in "" "-O"; do
+        rm -f $B/$n.uco $B/$n.uob
+        if ! (cd $B && ./icg $opt -u $n.mc > out 2>&1); then
+            cat $B/out
+            echo "FAIL: icg $opt -u $n.mc"
+            fail=1
+            continue
+        fi
+        for code in uco uob; do
+            # the first line tells assembling from loading
+            $B/ucodei $B/$n.$code $B/$n.lst < /dev/null 2>&1 | sed 1d > $B/out
+            if ! cmp -s $B/out $n.out; then
+                echo "FAIL: icg $opt $n.mc, ucodei $n.$code"
+                diff $n.out $B/out
+                fail=1
+            fi
+        done
+    done
+done
+[ $fail = 0 ] && echo "ok"
+exit $fail
@@ -0,0 +1,4 @@
+// the pre-standard header that ucodei.cpp includes, for a current C++
+// compiler(see check.sh)
+#include <fstream>
+using namespace std;
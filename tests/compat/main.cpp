@@ -0,0 +1,9 @@
+// ucodei.cpp has a void main(), which a current C++ compiler rejects.
+// check.sh compiles it with -Dmain=ucodei_main and links this main
+void ucodei_main(int argc, char *argv[]);
+
+int main(int argc, char *argv[])
+{
+    ucodei_main(argc, argv);
+    return 0;
+}
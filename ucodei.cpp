@@ -10,33 +10,23 @@
 #include <string.h>
 #include <stdlib.h>
 #include <ctype.h>
+#include <stdio.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#include "Ucode.h"
 
 const int MAXINSTR   = 2000;
 const int MAXLABELS  = 300;
 const int STACKSIZE  = 1000;
-const int LABELSIZE  = 10;
-const int NO_OPCODES = 41;
+const int LINESIZE   = 1024;     // longest line of the text Ucode
 
 ifstream inputFile;
 ofstream outputFile;
 
-enum opcode {
-     notop, neg,   incop, decop, dup,  swp, add,  sub,   mult, divop,
-	 modop, andop, orop,  gt,    lt,   ge,  le,   eq,    ne,
-	 lod,   ldc,   lda,   ldi,   ldp,  str, sti,  ujp,   tjp,  fjp,
-	 call,  ret,   retv,  chkh,  chkl, nop, proc, endop, bgn,  sym,
-	 dump,  none
-};
-
-char* opcodeName[NO_OPCODES] = {
-     "notop", "neg",  "inc", "dec",  "dup", "swp",  "add", "sub",
-	 "mult",  "div",  "mod", "and",  "or",  "gt",   "lt",  "ge",
-	 "le",    "eq",   "ne",	 "lod",  "ldc", "lda",  "ldi", "ldp",
-	 "str",   "sti",  "ujp", "tjp",  "fjp", "call", "ret", "retv",
-	 "chkh",  "chkl", "nop", "proc", "end", "bgn",  "sym", "dump",
-	 "none"
-};
-
 int executable[NO_OPCODES] = {
      /*notop*/ 1, /*neg*/  1, /*inc*/ 1, /*dec*/  1, /*dup*/  1,
 	 /*swp*/   1, /*add*/  1, /*sub*/ 1, /*mult*/ 1, /*div*/  1,
@@ -46,7 +36,8 @@ int executable[NO_OPCODES] = {
 	 /*sti*/   1, /*ujp*/  1, /*tjp*/ 1, /*fjp*/  1, /*call*/ 1,
 	 /*ret*/   1, /*retv*/ 1, /*chkh*/1, /*chkl*/ 1, /*nop*/  0,
 	 /*proc*/  1, /*end*/  0, /*bgn*/ 0, /*sym*/  0, /*dump*/ 1,
-	 /*none*/  0
+	 /*jeq*/   1, /*jne*/  1, /*jgt*/ 1, /*jlt*/  1, /*jge*/  1,
+	 /*jle*/   1, /*none*/ 0
 };
 
 int opcodeCycle[NO_OPCODES] = {
@@ -58,23 +49,19 @@ int opcodeCycle[NO_OPCODES] = {
 	 /*sti*/   10, /*ujp*/ 10, /*tjp*/ 10, /*fjp*/  10, /*call*/  30,
 	 /*ret*/   30, /*retv*/30, /*chkh*/ 5, /*chkl*/  5, /*nop*/    0,
 	 /*proc*/  30, /*end*/  0, /*bgn*/  0, /*sym*/   0, /*dump*/ 100,
-	 /*none*/   0
+	 /*jeq*/   20, /*jne*/ 20, /*jgt*/ 20, /*jlt*/  20, /*jge*/   20,
+	 /*jle*/   20, /*none*/ 0
 };
 
 int staticCnt[NO_OPCODES], dynamicCnt[NO_OPCODES];
 enum {FALSE, TRUE};
-enum procIndex {READPROC = -1, WRITEPROC = -2, LFPROC = -3};
 
-typedef struct {
-     int opcode;
-     int value1;
-     int value2;
-     int value3;
-} Instruction;
+typedef UcodeInstruction Instruction;
 
-Instruction instrBuf[MAXINSTR];
+Instruction textBuf[MAXINSTR];		// instructions assembled from the text
+Instruction *instrBuf = textBuf;	// or those of a mapped object file
 
-void errmsg(char* s, char* s2 = "")
+void errmsg(const char* s, const char* s2 = "")
 {
      cerr << "error !!!  " << s << ":  " << s2 << "\n";
      exit(1);
@@ -101,13 +88,14 @@ class Label {
          struct fixUpList *next;
      };
      struct labelEntry {
-         char labelName[LABELSIZE];
+         const char *labelName;     // any length, see saveName()
          int address;
          struct fixUpList *instrList;
      };
      struct labelEntry labelTable[MAXLABELS];
      int labelCnt;
      void addFix(struct fixUpList*, int);
+     char *saveName(char []);
 public:
      void insertLabel(char [], int);
      void findLabel(char [], int);
@@ -117,10 +105,10 @@ public:
 
 class Assemble {
      int instrCnt;
-     char lineBuffer[80];
+     char lineBuffer[LINESIZE];
      int bufIndex;
      Label labelProcess;
-     char label[LABELSIZE];
+     char label[LINESIZE];
      void getLabel();
      int getOpcode();
      int getOperand();
@@ -133,6 +121,15 @@ public:
      }
 };
 
+class Object {
+     int instrCnt;
+     void instrWrite();
+public:
+     int load(char *);
+     int startAddr;
+     Object() { instrCnt = 0; startAddr = 0; }
+};
+
 class Interpret {
      UcodeiStack stack;
      int arBase;
@@ -185,17 +182,28 @@ int& UcodeiStack::operator[](int index)
 Label::Label()
 {
      labelCnt = 2;
-     strcpy(labelTable[0].labelName, "read");
+     labelTable[0].labelName = "read";
      labelTable[0].address = READPROC;
      labelTable[0].instrList = NULL;
-     strcpy(labelTable[1].labelName, "write");
+     labelTable[1].labelName = "write";
      labelTable[1].address = WRITEPROC;
      labelTable[1].instrList = NULL;
-     strcpy(labelTable[2].labelName, "lf");
+     labelTable[2].labelName = "lf";
      labelTable[2].address = LFPROC;
      labelTable[2].instrList = NULL;
 }
 
+// a copy of the label, procedure names are not limited in length
+char *Label::saveName(char label[])
+{
+     char *name;
+
+     name = new char[strlen(label) + 1];
+     if (name == NULL) errmsg("saveName()", "Out of memory -- new");
+     strcpy(name, label);
+     return name;
+}
+
 void Label::insertLabel(char label[], int value)
 {
      struct fixUpList *ptr;
@@ -205,7 +213,7 @@ void Label::insertLabel(char label[], int value)
              && strcmp(labelTable[index].labelName, label); index++);
      labelTable[index].address = value;
      if (index > labelCnt) {
-                  strcpy(labelTable[index].labelName, label);
+                  labelTable[index].labelName = saveName(label);
                   labelCnt = index;
                   labelTable[index].instrList = NULL;
      } else {
@@ -226,7 +234,7 @@ void Label::findLabel(char label[], int instr)
      for (index=0; (index <= labelCnt) &&
           strcmp(label, labelTable[index].labelName); index++);
      if (index > labelCnt) { // not found
-          strcpy(labelTable[index].labelName, label);
+          labelTable[index].labelName = saveName(label);
           labelCnt = index;
           ptr = new fixUpList;
           if (ptr == NULL) errmsg("findLabel()", "Out of memory -- new");
@@ -258,20 +266,21 @@ void Assemble::getLabel()
      int i;
 
      while (isspace(lineBuffer[bufIndex])) bufIndex++;
-     for (i=0; i<=LABELSIZE && !isspace(label[i]=lineBuffer[bufIndex]);
+     for (i=0; i<LINESIZE-1 && lineBuffer[bufIndex]
+               && !isspace(label[i]=lineBuffer[bufIndex]);
           bufIndex++, i++);
      label[i] = '\0';
 }
 
 int Assemble::getOpcode()
 {
-     char mnemonic[5];
+     char mnemonic[6];
      int index;
 
-	 // always start at 12-th column.
-     bufIndex = 11;
+	 // after the label, at the 12-th column unless the label is longer
+     while (isspace(lineBuffer[bufIndex])) bufIndex++;
      index = 0;
-     while (index < 5 && !isspace(lineBuffer[bufIndex])) {
+     while (index < 5 && lineBuffer[bufIndex] && !isspace(lineBuffer[bufIndex])) {
           mnemonic[index++] = lineBuffer[bufIndex++]; 
      }
      mnemonic[index] = '\0';
@@ -285,13 +294,17 @@ int Assemble::getOpcode()
 
 int Assemble::getOperand()
 {
-     int result;
+     int result, sign = 1;
 
      while (isspace(lineBuffer[bufIndex])) bufIndex++;
+     if (lineBuffer[bufIndex] == '-') {		// ldc of a folded constant
+          sign = -1;
+          bufIndex++;
+     }
      result = 0;
      while (isdigit(lineBuffer[bufIndex]) && lineBuffer[bufIndex] != '\n')
           result = 10*result + (lineBuffer[bufIndex++]-'0');
-     return result;
+     return sign*result;
 }
 
 void Assemble::instrWrite()
@@ -308,7 +321,8 @@ void Assemble::instrWrite()
           outputFile << instrBuf[i].opcode;
           j = instrBuf[i].opcode;
           if (j == chkl || j == chkh || j==ldc   || j == bgn ||
-              j == ujp  || j == call || j == fjp || j == tjp) {
+              j == ujp  || j == call || j == fjp || j == tjp ||
+              (j >= jeq && j <= jle)) {
                outputFile.width(5);
                outputFile << instrBuf[i].value1 << "     ";
           } else if (j==lod || j==str || j==lda || j==sym || j==proc) {
@@ -334,6 +348,7 @@ void Assemble::assemble()
      cout << " == Assembling ... ==" << '\n';
      while (!inputFile.eof() && !inputFile.fail() && !end) {
           instrCnt++; bufIndex = 0;
+          if (instrCnt == MAXINSTR) errmsg("assemble()", "Too many instructions...");
           inputFile.getline(lineBuffer, sizeof(lineBuffer));
           if (!isspace(lineBuffer[0])) {
                   getLabel();
@@ -368,6 +383,8 @@ void Assemble::assemble()
           case call:
           case fjp:
           case tjp:
+          case jeq: case jne: case jgt:
+          case jlt: case jge: case jle:
                   getLabel();
                   labelProcess.findLabel(label, instrCnt);
                   break;
@@ -378,6 +395,96 @@ void Assemble::assemble()
      instrWrite();
 }
 
+// an object file written by "icg -u"(see Ucode.h) is mapped as it is:
+// its jumps and calls hold addresses, so nothing is assembled.
+// returns FALSE if the file is not an object file
+int Object::load(char *fileName)
+{
+     UcodeHeader header;
+     FILE *fp;
+     char *image;
+     long size;
+     int i;
+
+     if (!(fp = fopen(fileName, "rb"))) errmsg("cannot open input file", fileName);
+     if (fread(&header, sizeof(header), 1, fp) != 1 || header.magic != UCODE_MAGIC) {
+          fclose(fp);
+          return FALSE;
+     }
+     if (header.version != UCODE_VERSION) errmsg("wrong object file version", fileName);
+     fseek(fp, 0, SEEK_END);
+     size = ftell(fp);
+     if (header.noInstructions < 1 || header.startAddress < 1
+         || header.startAddress > header.noInstructions
+         || size != (long)sizeof(header) + (header.noInstructions + 1) * (long)sizeof(Instruction))
+          errmsg("broken object file", fileName);
+#ifndef _WIN32
+     fclose(fp);
+     int fd = open(fileName, O_RDONLY);
+     image = fd < 0 ? (char*)MAP_FAILED
+           : (char*)mmap(0, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+     if (image == (char*)MAP_FAILED) errmsg("cannot map input file", fileName);
+     close(fd);
+#else
+     if (!(image = new char[size])) errmsg("out of memory", fileName);
+     fseek(fp, 0, SEEK_SET);
+     if (fread(image, 1, size, fp) != (size_t)size) errmsg("cannot read input file", fileName);
+     fclose(fp);
+#endif
+
+     cout << " == Loading ... ==" << '\n';
+     instrBuf = (Instruction*)(image + sizeof(header));
+     instrCnt = header.noInstructions;
+     startAddr = header.startAddress;
+     for (i=1; i<=instrCnt; i++) {
+          int j = instrBuf[i].opcode, target = instrBuf[i].value1;
+          if (j < notop || j >= none)
+               errmsg("broken object file", fileName);
+          // a jump or a call outside the code would run off instrBuf
+          if ((j == ujp || j == tjp || j == fjp || (j >= jeq && j <= jle)
+                || (j == call && target != READPROC && target != WRITEPROC
+                    && target != LFPROC))
+               && (target < 1 || target > instrCnt))
+               errmsg("broken object file", fileName);
+          staticCnt[j]++;
+     }
+     instrWrite();
+     return TRUE;
+}
+
+// the listing of Assemble::instrWrite(), the ucode column is disassembled
+void Object::instrWrite()
+{
+     int i, j;
+
+     outputFile << "\n line       object           ucode  source program\n\n";
+     for (i=1; i<=instrCnt; i++)
+     {    outputFile.width(4);
+          outputFile << i << "    (";
+          outputFile.width(2);
+          outputFile << instrBuf[i].opcode;
+          j = instrBuf[i].opcode;
+          if (j == chkl || j == chkh || j==ldc   || j == bgn ||
+              j == ujp  || j == call || j == fjp || j == tjp ||
+              (j >= jeq && j <= jle)) {
+               outputFile.width(5);
+               outputFile << instrBuf[i].value1 << "     ";
+          } else if (j==lod || j==str || j==lda || j==sym || j==proc) {
+               outputFile.width(5);
+               outputFile << instrBuf[i].value1;
+               outputFile.width(5);
+               outputFile << instrBuf[i].value2;
+          } else outputFile << "          ";
+          outputFile << ")                ";
+          outputFile << opcodeName[j];
+          if (opcodeOperands[j] > 0) outputFile << ' ' << instrBuf[i].value1;
+          if (opcodeOperands[j] > 1) outputFile << ' ' << instrBuf[i].value2;
+          if (opcodeOperands[j] > 2) outputFile << ' ' << instrBuf[i].value3;
+          outputFile.put('\n');
+     }
+     outputFile << "\n\n   ****    Result    ****\n\n";
+}
+
 Interpret::Interpret()
         : stack(STACKSIZE)
 {
@@ -477,7 +584,7 @@ void Interpret::statistic()
 
 void Interpret::execute(int startAddr)
 {
-     int parms;
+     int parms = 0;
      int temp, temp1;
      int pc;
 
@@ -585,6 +692,31 @@ void Interpret::execute(int startAddr)
           case fjp:
                   if (!stack.pop()) pc = instrBuf[pc].value1 - 1;
                   break;
+		  /* compare and branch: jump if a op b */
+          case jeq:
+                  temp = stack.pop();
+                  if (stack.pop() == temp) pc = instrBuf[pc].value1 - 1;
+                  break;
+          case jne:
+                  temp = stack.pop();
+                  if (stack.pop() != temp) pc = instrBuf[pc].value1 - 1;
+                  break;
+          case jgt:
+                  temp = stack.pop();
+                  if (stack.pop() > temp) pc = instrBuf[pc].value1 - 1;
+                  break;
+          case jlt:
+                  temp = stack.pop();
+                  if (stack.pop() < temp) pc = instrBuf[pc].value1 - 1;
+                  break;
+          case jge:
+                  temp = stack.pop();
+                  if (stack.pop() >= temp) pc = instrBuf[pc].value1 - 1;
+                  break;
+          case jle:
+                  temp = stack.pop();
+                  if (stack.pop() <= temp) pc = instrBuf[pc].value1 - 1;
+                  break;
           case chkh:
                   temp = stack.pop();
                   if (temp > instrBuf[pc].value1)
@@ -598,15 +730,24 @@ void Interpret::execute(int startAddr)
                   stack.push(temp);
                   break;
           case ldp:
-                  parms = stack.top() + 1;				// save sp
+                  // a call in the arguments of another one has its own
+                  // ldp: the frame of the outer call waits in the block
+                  // level slot, which proc sets only after the call
+                  temp = stack.top() + 1;
                   stack.spSet(stack.top()+4);			// set a frame
+                  stack[temp+3] = parms;
+                  parms = temp;							// save sp
                   break;
           case call:
-                  if ((temp=instrBuf[pc].value1) < 0) predefinedProc(temp);
+                  if ((temp=instrBuf[pc].value1) < 0) {
+                       if (temp != LFPROC) parms = stack[parms+3];	// lf has no ldp
+                       predefinedProc(temp);
+                  }
                     else {
                            stack[parms+2] = pc + 1 ;	// save return address
                            stack[parms+1] = arBase;		// dynamic chain
                            arBase = parms;				// update arBase
+                           parms = stack[arBase+3];		// the outer call
                            pc = instrBuf[pc].value1 - 1;// jump to the function	
                          }
                   break;
@@ -647,7 +788,7 @@ void Interpret::execute(int startAddr)
                   temp = stack.pop();
                   stack.push(--temp);
                   break;
-		  case dup:		/* duplicate */
+		  case dupop:	/* duplicate */
                   temp = stack.pop();
                   stack.push(temp);
                   stack.push(temp);
@@ -665,14 +806,21 @@ void Interpret::execute(int startAddr)
 void main(int argc, char *argv[])
 {
      Assemble sourceProgram;
+     Object objectProgram;
      Interpret binaryProgram;
 
      if (argc != 3) errmsg("main()", "Wrong number of arguments");
 
+     outputFile.open(argv[2], ios::out);
+     if (objectProgram.load(argv[1])) {
+          binaryProgram.execute(objectProgram.startAddr);
+          outputFile.close();
+          return;
+     }
+
      inputFile.open(argv[1], ios::in);
      if (!inputFile) errmsg("cannot open input file", argv[1]);
 
-     outputFile.open(argv[2], ios::out);
      // if (!outputFile) errmsg("cannot open output file", argv[2]);
 
      sourceProgram.assemble();